@@ -21,7 +21,8 @@ public class NsTween : ModuleRules
             new string[]
             {
                 "Slate",
-                "SlateCore"
+                "SlateCore",
+                "UMG"
             }
         );
 
@@ -0,0 +1,168 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenInstanceBatcher.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Utils/NsTweenProfiling.h"
+
+int32 FNsTweenInstanceBatcher::AcquireSlot(UInstancedStaticMeshComponent* Component)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenInstanceBatcher::AcquireSlot");
+    if (!Component)
+    {
+        return INDEX_NONE;
+    }
+
+    const FObjectKey Key(Component);
+    const int32 Existing = Slots.AddReference(Key);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    const int32 SlotIndex = Slots.Add(Key);
+    Slots[SlotIndex].Component = Component;
+    return SlotIndex;
+}
+
+void FNsTweenInstanceBatcher::ReleaseSlot(int32 SlotIndex)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenInstanceBatcher::ReleaseSlot");
+    Slots.Release(SlotIndex);
+}
+
+FTransform* FNsTweenInstanceBatcher::WriteTransforms(int32 SlotIndex, int32 FirstInstance, int32 Count)
+{
+    if (!Slots.IsValid(SlotIndex) || FirstInstance < 0 || Count <= 0)
+    {
+        return nullptr;
+    }
+
+    FSlot& Slot = Slots.MarkDirty(SlotIndex);
+    FSpan& Span = Slot.TransformSpans.AddDefaulted_GetRef();
+    Span.FirstInstance = FirstInstance;
+    Span.Count = Count;
+    Span.Offset = Slot.Transforms.AddUninitialized(Count);
+    return Slot.Transforms.GetData() + Span.Offset;
+}
+
+float* FNsTweenInstanceBatcher::WriteCustomData(int32 SlotIndex, int32 FirstInstance, int32 Count, int32 CustomDataIndex, int32 NumCustomData)
+{
+    if (!Slots.IsValid(SlotIndex) || FirstInstance < 0 || Count <= 0 || CustomDataIndex < 0 || NumCustomData <= 0)
+    {
+        return nullptr;
+    }
+
+    FSlot& Slot = Slots.MarkDirty(SlotIndex);
+    FSpan& Span = Slot.CustomDataSpans.AddDefaulted_GetRef();
+    Span.FirstInstance = FirstInstance;
+    Span.Count = Count;
+    Span.CustomDataIndex = CustomDataIndex;
+    Span.NumCustomData = NumCustomData;
+    Span.Offset = Slot.CustomData.AddUninitialized(Count * NumCustomData);
+    return Slot.CustomData.GetData() + Span.Offset;
+}
+
+void FNsTweenInstanceBatcher::Flush()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenInstanceBatcher::Flush");
+    Slots.Flush([this](TConstArrayView<int32> Written)
+    {
+        int32 Submitted = 0;
+        for (const int32 SlotIndex : Written)
+        {
+            FSlot& Slot = Slots[SlotIndex];
+            UInstancedStaticMeshComponent* Component = Slot.Component.Get();
+            if (Component && SubmitSlot(*Component, Slot))
+            {
+                ++Submitted;
+            }
+
+            // Buffers keep their capacity: the same spans are written again next tick.
+            Slot.TransformSpans.Reset();
+            Slot.Transforms.Reset();
+            Slot.CustomDataSpans.Reset();
+            Slot.CustomData.Reset();
+        }
+        return Submitted;
+    });
+}
+
+void FNsTweenInstanceBatcher::Empty()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenInstanceBatcher::Empty");
+    Slots.Empty();
+    MergedTransforms.Empty();
+    MergedCoverage.Empty();
+}
+
+bool FNsTweenInstanceBatcher::SubmitSlot(UInstancedStaticMeshComponent& Component, FSlot& Slot)
+{
+    const int32 InstanceCount = Component.GetInstanceCount();
+    bool bUpdated = false;
+
+    if (Slot.TransformSpans.Num() == 1 && Slot.TransformSpans[0].FirstInstance + Slot.TransformSpans[0].Count <= InstanceCount)
+    {
+        // The common case, one tween per component, is submitted straight from the slot's buffer.
+        bUpdated |= Component.BatchUpdateInstancesTransforms(Slot.TransformSpans[0].FirstInstance, Slot.Transforms, false, false, false);
+    }
+    else if (Slot.TransformSpans.Num() > 0)
+    {
+        // Several spans are merged into their enclosing range; instances between spans are resubmitted unchanged.
+        int32 First = MAX_int32;
+        int32 Last = 0;
+        for (const FSpan& Span : Slot.TransformSpans)
+        {
+            First = FMath::Min(First, Span.FirstInstance);
+            Last = FMath::Max(Last, Span.FirstInstance + Span.Count);
+        }
+        Last = FMath::Min(Last, InstanceCount);
+
+        if (First < Last)
+        {
+            MergedTransforms.SetNumUninitialized(Last - First, EAllowShrinking::No);
+            MergedCoverage.Init(false, Last - First);
+
+            // Later writes win where spans overlap.
+            for (const FSpan& Span : Slot.TransformSpans)
+            {
+                const int32 Count = FMath::Min(Span.Count, Last - Span.FirstInstance);
+                for (int32 Index = 0; Index < Count; ++Index)
+                {
+                    MergedTransforms[Span.FirstInstance - First + Index] = Slot.Transforms[Span.Offset + Index];
+                    MergedCoverage[Span.FirstInstance - First + Index] = true;
+                }
+            }
+
+            for (int32 Index = 0; Index < MergedCoverage.Num(); ++Index)
+            {
+                if (!MergedCoverage[Index])
+                {
+                    Component.GetInstanceTransform(First + Index, MergedTransforms[Index], false);
+                }
+            }
+
+            bUpdated |= Component.BatchUpdateInstancesTransforms(First, MergedTransforms, false, false, false);
+        }
+    }
+
+    for (const FSpan& Span : Slot.CustomDataSpans)
+    {
+        const int32 Count = FMath::Min(Span.Count, InstanceCount - Span.FirstInstance);
+        const float* Values = Slot.CustomData.GetData() + Span.Offset;
+        for (int32 Instance = 0; Instance < Count; ++Instance)
+        {
+            for (int32 Channel = 0; Channel < Span.NumCustomData; ++Channel)
+            {
+                bUpdated |= Component.SetCustomDataValue(Span.FirstInstance + Instance, Span.CustomDataIndex + Channel, Values[Instance * Span.NumCustomData + Channel], false);
+            }
+        }
+    }
+
+    // Every write above skipped the render state update; the component is dirtied once for all of them.
+    if (bUpdated)
+    {
+        Component.MarkRenderStateDirty();
+    }
+
+    return bUpdated;
+}
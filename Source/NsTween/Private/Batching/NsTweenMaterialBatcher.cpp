@@ -0,0 +1,218 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenMaterialBatcher.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Utils/NsTweenLogging.h"
+#include "Utils/NsTweenProfiling.h"
+
+int32 FNsTweenMaterialBatcher::AcquireParameter(UObject* Instance, FName ParameterName, ENsTweenMaterialParameterType Type, const FLinearColor& InitialValue)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenMaterialBatcher::AcquireParameter");
+    if (!Instance)
+    {
+        return INDEX_NONE;
+    }
+
+    const TTuple<FObjectKey, FName, uint8> LookupKey(FObjectKey(Instance), ParameterName, static_cast<uint8>(Type));
+    const int32 Existing = Parameters.AddReference(LookupKey);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    const bool bScalar = Type == ENsTweenMaterialParameterType::Scalar;
+    int32 ParameterIndex = INDEX_NONE;
+    bool bCollection = false;
+    if (UMaterialInstanceDynamic* Material = Cast<UMaterialInstanceDynamic>(Instance))
+    {
+        const bool bResolved = bScalar
+            ? Material->InitializeScalarParameterAndGetIndex(ParameterName, InitialValue.R, ParameterIndex)
+            : Material->InitializeVectorParameterAndGetIndex(ParameterName, InitialValue, ParameterIndex);
+        if (!bResolved)
+        {
+            UE_LOG(LogNsTween, Warning, TEXT("Cannot tween material parameter '%s' on %s."), *ParameterName.ToString(), *GetNameSafe(Instance));
+            return INDEX_NONE;
+        }
+    }
+    else if (UMaterialParameterCollectionInstance* CollectionInstance = Cast<UMaterialParameterCollectionInstance>(Instance))
+    {
+        const UMaterialParameterCollection* Collection = CollectionInstance->GetCollection();
+        const bool bExists = Collection && (bScalar
+            ? Collection->GetScalarParameterByName(ParameterName) != nullptr
+            : Collection->GetVectorParameterByName(ParameterName) != nullptr);
+        if (!bExists)
+        {
+            UE_LOG(LogNsTween, Warning, TEXT("Cannot tween material parameter '%s': %s has no such %s parameter."),
+                *ParameterName.ToString(), *GetNameSafe(Collection), bScalar ? TEXT("scalar") : TEXT("vector"));
+            return INDEX_NONE;
+        }
+
+        bCollection = true;
+        if (bScalar)
+        {
+            CollectionInstance->SetScalarParameterValue(ParameterName, InitialValue.R);
+        }
+        else
+        {
+            CollectionInstance->SetVectorParameterValue(ParameterName, InitialValue);
+        }
+    }
+    else
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Cannot tween material parameter '%s': %s is not a dynamic material or parameter collection instance."),
+            *ParameterName.ToString(), *GetNameSafe(Instance));
+        return INDEX_NONE;
+    }
+
+    const int32 InstanceIndex = FindOrAddInstance(Instance, bCollection);
+    const int32 ParameterSlot = Parameters.Add(LookupKey);
+    FParameter& Parameter = Parameters[ParameterSlot];
+    Parameter.Name = ParameterName;
+    Parameter.Value = InitialValue;
+    Parameter.Instance = InstanceIndex;
+    Parameter.ParameterIndex = ParameterIndex;
+    Parameter.Type = Type;
+    ++Instances[InstanceIndex].NumParameters;
+    return ParameterSlot;
+}
+
+void FNsTweenMaterialBatcher::ReleaseParameter(int32 ParameterSlot)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenMaterialBatcher::ReleaseParameter");
+    Parameters.Release(ParameterSlot, [this](int32, FParameter& Parameter) { ReleaseInstance(Parameter.Instance); });
+}
+
+void FNsTweenMaterialBatcher::Write(int32 ParameterSlot, const FLinearColor& Value)
+{
+    if (Parameters.IsValid(ParameterSlot))
+    {
+        Parameters.MarkDirty(ParameterSlot).Value = Value;
+    }
+}
+
+void FNsTweenMaterialBatcher::Flush()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenMaterialBatcher::Flush");
+
+    // Collection setters broadcast update delegates; writes made from them are flushed next time.
+    auto WriteInstances = [this](TConstArrayView<int32> Written)
+    {
+        for (const int32 ParameterSlot : Written)
+        {
+            const int32 InstanceIndex = Parameters[ParameterSlot].Instance;
+            if (Instances[InstanceIndex].DirtyParameters.Num() == 0)
+            {
+                FlushingInstances.Add(InstanceIndex);
+            }
+            Instances[InstanceIndex].DirtyParameters.Add(ParameterSlot);
+        }
+
+        int32 Updated = 0;
+        for (const int32 InstanceIndex : FlushingInstances)
+        {
+            TArray<int32, TInlineAllocator<4>> Grouped = MoveTemp(Instances[InstanceIndex].DirtyParameters);
+            Instances[InstanceIndex].DirtyParameters.Reset();
+
+            // The instance is resolved once for all of its parameters.
+            UObject* Object = Instances[InstanceIndex].Object.Get();
+            if (!Object)
+            {
+                continue;
+            }
+
+            if (Instances[InstanceIndex].bCollection)
+            {
+                UMaterialParameterCollectionInstance* CollectionInstance = static_cast<UMaterialParameterCollectionInstance*>(Object);
+                for (const int32 ParameterSlot : Grouped)
+                {
+                    const FParameter Parameter = Parameters[ParameterSlot];
+                    if (Parameter.Type == ENsTweenMaterialParameterType::Scalar)
+                    {
+                        CollectionInstance->SetScalarParameterValue(Parameter.Name, Parameter.Value.R);
+                    }
+                    else
+                    {
+                        CollectionInstance->SetVectorParameterValue(Parameter.Name, Parameter.Value);
+                    }
+                }
+            }
+            else
+            {
+                UMaterialInstanceDynamic* Material = static_cast<UMaterialInstanceDynamic*>(Object);
+                for (const int32 ParameterSlot : Grouped)
+                {
+                    WriteDynamicParameter(*Material, ParameterSlot, Parameters[ParameterSlot].Value);
+                }
+            }
+            ++Updated;
+        }
+
+        FlushingInstances.Reset();
+        return Updated;
+    };
+
+    Parameters.Flush(WriteInstances, [this](int32, FParameter& Parameter) { ReleaseInstance(Parameter.Instance); });
+}
+
+void FNsTweenMaterialBatcher::Empty()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenMaterialBatcher::Empty");
+    Parameters.Empty();
+    Instances.Empty();
+    FreeInstances.Empty();
+    InstanceLookup.Empty();
+    FlushingInstances.Empty();
+}
+
+int32 FNsTweenMaterialBatcher::FindOrAddInstance(UObject* Object, bool bCollection)
+{
+    const FObjectKey Key(Object);
+    if (const int32* Existing = InstanceLookup.Find(Key))
+    {
+        return *Existing;
+    }
+
+    const int32 InstanceIndex = FreeInstances.Num() > 0 ? FreeInstances.Pop(EAllowShrinking::No) : Instances.AddDefaulted();
+    FInstance& Instance = Instances[InstanceIndex];
+    Instance = FInstance();
+    Instance.Object = Object;
+    Instance.Key = Key;
+    Instance.bCollection = bCollection;
+    InstanceLookup.Add(Key, InstanceIndex);
+    return InstanceIndex;
+}
+
+void FNsTweenMaterialBatcher::ReleaseInstance(int32 InstanceIndex)
+{
+    FInstance& Instance = Instances[InstanceIndex];
+    if (--Instance.NumParameters == 0)
+    {
+        InstanceLookup.Remove(Instance.Key);
+        Instance.Object.Reset();
+        FreeInstances.Add(InstanceIndex);
+    }
+}
+
+void FNsTweenMaterialBatcher::WriteDynamicParameter(UMaterialInstanceDynamic& Material, int32 ParameterSlot, const FLinearColor& Value)
+{
+    FParameter& Parameter = Parameters[ParameterSlot];
+    const bool bScalar = Parameter.Type == ENsTweenMaterialParameterType::Scalar;
+    const bool bWritten = bScalar
+        ? Material.SetScalarParameterByIndex(Parameter.ParameterIndex, Value.R)
+        : Material.SetVectorParameterByIndex(Parameter.ParameterIndex, Value);
+
+    // The cached index goes stale if the instance's parameters were cleared; resolve it again by name.
+    if (!bWritten)
+    {
+        if (bScalar)
+        {
+            Material.InitializeScalarParameterAndGetIndex(Parameter.Name, Value.R, Parameter.ParameterIndex);
+        }
+        else
+        {
+            Material.InitializeVectorParameterAndGetIndex(Parameter.Name, Value, Parameter.ParameterIndex);
+        }
+    }
+}
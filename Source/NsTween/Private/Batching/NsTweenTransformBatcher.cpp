@@ -0,0 +1,258 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenTransformBatcher.h"
+#include "Components/SceneComponent.h"
+#include "Utils/NsTweenProfiling.h"
+
+int32 FNsTweenTransformBatcher::AcquireSlot(USceneComponent* Component, ENsTweenTransformSpace Space)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenTransformBatcher::AcquireSlot");
+    if (!Component)
+    {
+        return INDEX_NONE;
+    }
+
+    const TPair<FObjectKey, uint8> LookupKey(FObjectKey(Component), static_cast<uint8>(Space));
+    const int32 Existing = Slots.AddReference(LookupKey);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    const int32 SlotIndex = Slots.Add(LookupKey);
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.Component = Component;
+    Slot.Space = Space;
+    return SlotIndex;
+}
+
+void FNsTweenTransformBatcher::ReleaseSlot(int32 SlotIndex)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenTransformBatcher::ReleaseSlot");
+    Slots.Release(SlotIndex);
+}
+
+void FNsTweenTransformBatcher::Write(int32 SlotIndex, ENsTweenTransformChannel Channels, const FVector& Location, const FQuat& Rotation, const FVector& Scale, bool bSweep, bool bTeleport)
+{
+    if (!Slots.IsValid(SlotIndex))
+    {
+        return;
+    }
+
+    FSlot& Slot = Slots.MarkDirty(SlotIndex);
+
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Location))
+    {
+        Slot.Location = Location;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Rotation))
+    {
+        Slot.Rotation = Rotation;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Scale))
+    {
+        Slot.Scale = Scale;
+    }
+
+    Slot.DirtyChannels |= Channels;
+    Slot.bSweep |= bSweep;
+    Slot.bTeleport |= bTeleport;
+}
+
+void FNsTweenTransformBatcher::WriteAdditive(int32 SlotIndex, const void* Layer, ENsTweenTransformChannel Channels, const FVector& Location, const FQuat& Rotation, const FVector& Scale, bool bBake, bool bSweep, bool bTeleport)
+{
+    if (!Slots.IsValid(SlotIndex))
+    {
+        return;
+    }
+
+    FSlot& Slot = Slots.MarkDirty(SlotIndex);
+    Slot.AdditiveChannels |= Channels;
+    Slot.bSweep |= bSweep;
+    Slot.bTeleport |= bTeleport;
+
+    const int32 LayerIndex = Slot.Layers.IndexOfByPredicate([Layer](const FLayer& Kept) { return Kept.Owner == Layer; });
+    if (bBake)
+    {
+        // The final offset becomes part of the base, so the layer has nothing left to keep.
+        if (LayerIndex != INDEX_NONE)
+        {
+            Slot.Layers.RemoveAtSwap(LayerIndex, 1, EAllowShrinking::No);
+        }
+        if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Location))
+        {
+            Slot.BakeLocation += Location;
+        }
+        if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Rotation))
+        {
+            Slot.BakeRotation = Rotation * Slot.BakeRotation;
+        }
+        if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Scale))
+        {
+            Slot.BakeScale += Scale;
+        }
+        return;
+    }
+
+    FLayer& Kept = LayerIndex != INDEX_NONE ? Slot.Layers[LayerIndex] : Slot.Layers.AddDefaulted_GetRef();
+    Kept.Owner = Layer;
+    Kept.Channels |= Channels;
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Location))
+    {
+        Kept.Location = Location;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Rotation))
+    {
+        Kept.Rotation = Rotation;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Scale))
+    {
+        Kept.Scale = Scale;
+    }
+}
+
+void FNsTweenTransformBatcher::ReleaseLayer(int32 SlotIndex, const void* Layer)
+{
+    if (!Slots.IsValid(SlotIndex))
+    {
+        return;
+    }
+
+    FSlot& Slot = Slots[SlotIndex];
+    const int32 LayerIndex = Slot.Layers.IndexOfByPredicate([Layer](const FLayer& Kept) { return Kept.Owner == Layer; });
+    if (LayerIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    // The channels are re-based on the next flush without this layer's offset.
+    Slots.MarkDirty(SlotIndex);
+    Slot.AdditiveChannels |= Slot.Layers[LayerIndex].Channels;
+    Slot.Layers.RemoveAtSwap(LayerIndex, 1, EAllowShrinking::No);
+}
+
+void FNsTweenTransformBatcher::Flush()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenTransformBatcher::Flush");
+
+    // Moves can raise overlap and hit events that start or stop tweens; their writes are flushed next time.
+    Slots.Flush([this](TConstArrayView<int32> Written)
+    {
+        int32 Moved = 0;
+        for (const int32 SlotIndex : Written)
+        {
+            // Copy out before moving: callbacks may acquire slots and reallocate the array.
+            FSlot& Slot = Slots[SlotIndex];
+            const FSlot Pending = Slot;
+            Slot.DirtyChannels = ENsTweenTransformChannel::None;
+            Slot.AdditiveChannels = ENsTweenTransformChannel::None;
+            Slot.BakeLocation = FVector::ZeroVector;
+            Slot.BakeRotation = FQuat::Identity;
+            Slot.BakeScale = FVector::ZeroVector;
+            Slot.bSweep = false;
+            Slot.bTeleport = false;
+
+            USceneComponent* Component = Pending.Component.Get();
+            if (!Component)
+            {
+                continue;
+            }
+
+            const bool bRelative = Pending.Space == ENsTweenTransformSpace::Relative;
+            const FTransform Current = bRelative ? Component->GetRelativeTransform() : Component->GetComponentTransform();
+            FTransform Transform = Current;
+            if (EnumHasAnyFlags(Pending.DirtyChannels, ENsTweenTransformChannel::Location))
+            {
+                Transform.SetLocation(Pending.Location);
+            }
+            if (EnumHasAnyFlags(Pending.DirtyChannels, ENsTweenTransformChannel::Rotation))
+            {
+                Transform.SetRotation(Pending.Rotation);
+            }
+            if (EnumHasAnyFlags(Pending.DirtyChannels, ENsTweenTransformChannel::Scale))
+            {
+                Transform.SetScale3D(Pending.Scale);
+            }
+
+            // Channels set outright this frame stop tracking a base until a layer writes them again. Kept layers go on
+            // whatever moved, including layers that did not write this frame.
+            Slot.LayeredChannels &= ~Pending.DirtyChannels;
+            ENsTweenTransformChannel LayerChannels = Pending.AdditiveChannels;
+            for (const FLayer& Layer : Pending.Layers)
+            {
+                LayerChannels |= Layer.Channels;
+            }
+            if (LayerChannels != ENsTweenTransformChannel::None)
+            {
+                ApplyLayers(Slot, Pending, LayerChannels, Current, Transform);
+            }
+            Slot.Committed = Transform;
+
+            // The scoped update defers child propagation and overlap work until the component has its final transform.
+            const ETeleportType Teleport = Pending.bTeleport ? ETeleportType::TeleportPhysics : ETeleportType::None;
+            {
+                FScopedMovementUpdate ScopedUpdate(Component, EScopedUpdate::DeferredUpdates);
+                if (bRelative)
+                {
+                    Component->SetRelativeTransform(Transform, Pending.bSweep, nullptr, Teleport);
+                }
+                else
+                {
+                    Component->SetWorldTransform(Transform, Pending.bSweep, nullptr, Teleport);
+                }
+            }
+            ++Moved;
+        }
+        return Moved;
+    });
+}
+
+void FNsTweenTransformBatcher::Empty()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenTransformBatcher::Empty");
+    Slots.Empty();
+}
+
+void FNsTweenTransformBatcher::ApplyLayers(FSlot& Slot, const FSlot& Pending, ENsTweenTransformChannel Channels, const FTransform& Current, FTransform& Transform)
+{
+    // Without an override this frame, layers go on last frame's base, unless the component was moved since. The
+    // tolerances absorb the round trip through the component's rotator and world transform.
+    auto KeepsBase = [&Pending](ENsTweenTransformChannel Channel, bool bUnmoved)
+    {
+        return !EnumHasAnyFlags(Pending.DirtyChannels, Channel) && EnumHasAnyFlags(Pending.LayeredChannels, Channel) && bUnmoved;
+    };
+
+    FVector AddLocation = Pending.BakeLocation;
+    FQuat AddRotation = Pending.BakeRotation;
+    FVector AddScale = Pending.BakeScale;
+    for (const FLayer& Layer : Pending.Layers)
+    {
+        AddLocation += EnumHasAnyFlags(Layer.Channels, ENsTweenTransformChannel::Location) ? Layer.Location : FVector::ZeroVector;
+        AddRotation = EnumHasAnyFlags(Layer.Channels, ENsTweenTransformChannel::Rotation) ? Layer.Rotation * AddRotation : AddRotation;
+        AddScale += EnumHasAnyFlags(Layer.Channels, ENsTweenTransformChannel::Scale) ? Layer.Scale : FVector::ZeroVector;
+    }
+
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Location))
+    {
+        const bool bUnmoved = Current.GetLocation().Equals(Pending.Committed.GetLocation(), 1.e-2);
+        const FVector Base = KeepsBase(ENsTweenTransformChannel::Location, bUnmoved) ? Pending.Base.GetLocation() : Transform.GetLocation();
+        Transform.SetLocation(Base + AddLocation);
+        Slot.Base.SetLocation(Base + Pending.BakeLocation);
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Rotation))
+    {
+        const bool bUnmoved = Current.GetRotation().AngularDistance(Pending.Committed.GetRotation()) < 1.e-3;
+        const FQuat Base = KeepsBase(ENsTweenTransformChannel::Rotation, bUnmoved) ? Pending.Base.GetRotation() : Transform.GetRotation();
+        Transform.SetRotation(AddRotation * Base);
+        Slot.Base.SetRotation(Pending.BakeRotation * Base);
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Scale))
+    {
+        const bool bUnmoved = Current.GetScale3D().Equals(Pending.Committed.GetScale3D(), 1.e-3);
+        const FVector Base = KeepsBase(ENsTweenTransformChannel::Scale, bUnmoved) ? Pending.Base.GetScale3D() : Transform.GetScale3D();
+        Transform.SetScale3D(Base + AddScale);
+        Slot.Base.SetScale3D(Base + Pending.BakeScale);
+    }
+
+    Slot.LayeredChannels |= Channels;
+}
@@ -0,0 +1,189 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenWidgetBatcher.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/Border.h"
+#include "Components/Image.h"
+#include "Components/TextBlock.h"
+#include "Components/Widget.h"
+#include "Utils/NsTweenProfiling.h"
+
+int32 FNsTweenWidgetBatcher::AcquireSlot(UWidget* Widget)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenWidgetBatcher::AcquireSlot");
+    if (!Widget)
+    {
+        return INDEX_NONE;
+    }
+
+    const FObjectKey Key(Widget);
+    const int32 Existing = Slots.AddReference(Key);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    const int32 SlotIndex = Slots.Add(Key);
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.Widget = Widget;
+
+    if (Widget->IsA<UImage>())
+    {
+        Slot.ColorTarget = EColorTarget::Image;
+    }
+    else if (Widget->IsA<UTextBlock>())
+    {
+        Slot.ColorTarget = EColorTarget::TextBlock;
+    }
+    else if (Widget->IsA<UBorder>())
+    {
+        Slot.ColorTarget = EColorTarget::Border;
+    }
+    else if (Widget->IsA<UUserWidget>())
+    {
+        Slot.ColorTarget = EColorTarget::UserWidget;
+    }
+
+    return SlotIndex;
+}
+
+void FNsTweenWidgetBatcher::ReleaseSlot(int32 SlotIndex)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenWidgetBatcher::ReleaseSlot");
+    Slots.Release(SlotIndex);
+}
+
+void FNsTweenWidgetBatcher::Write(int32 SlotIndex, ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& State)
+{
+    if (!Slots.IsValid(SlotIndex))
+    {
+        return;
+    }
+
+    FSlot& Slot = Slots.MarkDirty(SlotIndex);
+
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Translation))
+    {
+        Slot.Pending.Translation = State.Translation;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Scale))
+    {
+        Slot.Pending.Scale = State.Scale;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Shear))
+    {
+        Slot.Pending.Shear = State.Shear;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Angle))
+    {
+        Slot.Pending.Angle = State.Angle;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Opacity))
+    {
+        Slot.Pending.Opacity = State.Opacity;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Color))
+    {
+        Slot.Pending.Color = State.Color;
+    }
+
+    Slot.DirtyChannels |= Channels;
+}
+
+void FNsTweenWidgetBatcher::Flush()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenWidgetBatcher::Flush");
+    Slots.Flush([this](TConstArrayView<int32> Written)
+    {
+        int32 Invalidated = 0;
+        for (const int32 SlotIndex : Written)
+        {
+            FSlot& Slot = Slots[SlotIndex];
+            const ENsTweenWidgetChannel Channels = Slot.DirtyChannels;
+            Slot.DirtyChannels = ENsTweenWidgetChannel::None;
+
+            // Setters only invalidate; nothing they call back into can reach the batcher.
+            UWidget* Widget = Slot.Widget.Get();
+            if (Widget && ApplySlot(*Widget, Slot, Channels))
+            {
+                ++Invalidated;
+            }
+        }
+        return Invalidated;
+    });
+}
+
+void FNsTweenWidgetBatcher::Empty()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenWidgetBatcher::Empty");
+    Slots.Empty();
+}
+
+bool FNsTweenWidgetBatcher::ApplySlot(UWidget& Widget, FSlot& Slot, ENsTweenWidgetChannel Channels)
+{
+    bool bInvalidated = false;
+
+    // Every transform channel goes out in one SetRenderTransform: one render-transform invalidation, no layout.
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::RenderTransform))
+    {
+        FWidgetTransform Transform = Widget.GetRenderTransform();
+        if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Translation))
+        {
+            Transform.Translation = Slot.Pending.Translation;
+        }
+        if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Scale))
+        {
+            Transform.Scale = Slot.Pending.Scale;
+        }
+        if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Shear))
+        {
+            Transform.Shear = Slot.Pending.Shear;
+        }
+        if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Angle))
+        {
+            Transform.Angle = Slot.Pending.Angle;
+        }
+
+        if (Transform != Widget.GetRenderTransform())
+        {
+            Widget.SetRenderTransform(Transform);
+            bInvalidated = true;
+        }
+    }
+
+    // Opacity and color only invalidate paint. Both compare against the widget, so values set from elsewhere are overwritten.
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Opacity) && Slot.Pending.Opacity != Widget.GetRenderOpacity())
+    {
+        Widget.SetRenderOpacity(Slot.Pending.Opacity);
+        bInvalidated = true;
+    }
+
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Color) && Slot.ColorTarget != EColorTarget::None
+        && Slot.Pending.Color != GetColor(Widget, Slot.ColorTarget))
+    {
+        const FLinearColor& Color = Slot.Pending.Color;
+        switch (Slot.ColorTarget)
+        {
+            case EColorTarget::Image:      static_cast<UImage&>(Widget).SetColorAndOpacity(Color);                break;
+            case EColorTarget::TextBlock:  static_cast<UTextBlock&>(Widget).SetColorAndOpacity(FSlateColor(Color)); break;
+            case EColorTarget::Border:     static_cast<UBorder&>(Widget).SetBrushColor(Color);                    break;
+            case EColorTarget::UserWidget: static_cast<UUserWidget&>(Widget).SetColorAndOpacity(Color);           break;
+            default: break;
+        }
+        bInvalidated = true;
+    }
+
+    return bInvalidated;
+}
+
+FLinearColor FNsTweenWidgetBatcher::GetColor(const UWidget& Widget, EColorTarget ColorTarget)
+{
+    switch (ColorTarget)
+    {
+        case EColorTarget::Image:      return static_cast<const UImage&>(Widget).GetColorAndOpacity();
+        case EColorTarget::TextBlock:  return static_cast<const UTextBlock&>(Widget).GetColorAndOpacity().GetSpecifiedColor();
+        case EColorTarget::Border:     return static_cast<const UBorder&>(Widget).GetBrushColor();
+        case EColorTarget::UserWidget: return static_cast<const UUserWidget&>(Widget).GetColorAndOpacity();
+        default:                       return FLinearColor::White;
+    }
+}
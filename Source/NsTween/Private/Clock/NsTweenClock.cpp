@@ -0,0 +1,120 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Clock/NsTweenClock.h"
+#include "Utils/NsTweenProfiling.h"
+
+void FNsTweenClock::Start(const FNsTweenSpec& Timing)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenClock::Start");
+    DurationSeconds = FMath::Max(Timing.DurationSeconds, SMALL_NUMBER);
+    TimeScale = FMath::Max(Timing.TimeScale, 0.f);
+    DelayRemaining = FMath::Max(0.f, Timing.DelaySeconds);
+    LoopCount = FMath::Max(Timing.LoopCount, 0);
+    CompletedCycles = 0;
+    LoopEvents = 0;
+    PingPongEvents = 0;
+    WrapMode = Timing.WrapMode;
+    Direction = Timing.Direction;
+    bPlayingForward = Direction != ENsTweenDirection::Backward;
+    CycleTime = bPlayingForward ? 0.f : DurationSeconds;
+    bPaused = false;
+    bFinished = false;
+    bMoved = false;
+    bSeekPending = false;
+}
+
+void FNsTweenClock::Advance(float DeltaSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenClock::Advance");
+    // Events describe a single frame; attached tweens read them right after this call.
+    LoopEvents = 0;
+    PingPongEvents = 0;
+    bMoved = bSeekPending;
+    bSeekPending = false;
+
+    if (bPaused || bFinished)
+    {
+        return;
+    }
+
+    float RemainingTime = DeltaSeconds * TimeScale;
+    if (RemainingTime <= SMALL_NUMBER)
+    {
+        return;
+    }
+
+    if (DelayRemaining > SMALL_NUMBER)
+    {
+        if (RemainingTime < DelayRemaining)
+        {
+            DelayRemaining -= RemainingTime;
+            return;
+        }
+
+        RemainingTime -= DelayRemaining;
+        DelayRemaining = 0.f;
+    }
+
+    // Same boundary walk as FNsTween::Tick, so large steps cross several loops exactly.
+    bMoved = true;
+    while (RemainingTime > SMALL_NUMBER)
+    {
+        const float TimeToBoundary = FMath::Max(bPlayingForward ? DurationSeconds - CycleTime : CycleTime, 0.f);
+        if (RemainingTime <= TimeToBoundary + KINDA_SMALL_NUMBER)
+        {
+            CycleTime = FMath::Clamp(CycleTime + (bPlayingForward ? RemainingTime : -RemainingTime), 0.f, DurationSeconds);
+            return;
+        }
+
+        RemainingTime -= TimeToBoundary;
+        CycleTime = bPlayingForward ? DurationSeconds : 0.f;
+        if (!HandleBoundary())
+        {
+            bFinished = true;
+            return;
+        }
+    }
+}
+
+void FNsTweenClock::Seek(float CycleSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenClock::Seek");
+    CycleTime = FMath::Clamp(CycleSeconds, 0.f, DurationSeconds);
+    DelayRemaining = 0.f;
+    bSeekPending = true;
+}
+
+bool FNsTweenClock::HandleBoundary()
+{
+    if (WrapMode == ENsTweenWrapMode::Once)
+    {
+        return false;
+    }
+
+    if (WrapMode == ENsTweenWrapMode::Loop)
+    {
+        ++CompletedCycles;
+        ++LoopEvents;
+        if (LoopCount > 0 && CompletedCycles >= LoopCount)
+        {
+            return false;
+        }
+
+        bPlayingForward = Direction != ENsTweenDirection::Backward;
+        CycleTime = bPlayingForward ? 0.f : DurationSeconds;
+        return true;
+    }
+
+    bPlayingForward = !bPlayingForward;
+    ++PingPongEvents;
+    if (!bPlayingForward)
+    {
+        ++CompletedCycles;
+    }
+    else if (LoopCount > 0 && CompletedCycles >= LoopCount)
+    {
+        return false;
+    }
+
+    return true;
+}
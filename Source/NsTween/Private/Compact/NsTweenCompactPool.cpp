@@ -0,0 +1,190 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Compact/NsTweenCompactPool.h"
+#include "Easing/NsTweenPolynomialEasing.h"
+#include "Utils/NsTweenProfiling.h"
+
+namespace NsTweenCompact
+{
+    /** Progress value representing the end of the tween. */
+    constexpr double ProgressRange = 4294967296.0;
+
+    /** Converts quantized progress back to a normalized time. */
+    constexpr float ProgressToAlpha = static_cast<float>(1.0 / ProgressRange);
+}
+
+int32 FNsTweenCompactPool::RegisterTargets(TArrayView<float> Values, FNsTweenCompactComplete OnComplete)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompactPool::RegisterTargets");
+
+    int32 BlockId = INDEX_NONE;
+    if (FreeBlocks.Num() > 0)
+    {
+        BlockId = FreeBlocks.Pop(EAllowShrinking::No);
+    }
+    else if (Blocks.Num() < MaxBlocks)
+    {
+        BlockId = Blocks.AddDefaulted();
+    }
+    else
+    {
+        return INDEX_NONE;
+    }
+
+    FTargetBlock& Block = Blocks[BlockId];
+    Block.Values = Values.GetData();
+    Block.Num = Values.Num();
+    Block.OnComplete = MoveTemp(OnComplete);
+    return BlockId;
+}
+
+void FNsTweenCompactPool::UnregisterTargets(int32 BlockId)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompactPool::UnregisterTargets");
+
+    if (!Blocks.IsValidIndex(BlockId) || !Blocks[BlockId].Values)
+    {
+        return;
+    }
+
+    for (int32 Index = NumRecords - 1; Index >= 0; --Index)
+    {
+        if (At(Index).BlockId == BlockId)
+        {
+            RemoveAtSwap(Index);
+        }
+    }
+
+    Blocks[BlockId] = FTargetBlock();
+    FreeBlocks.Add(BlockId);
+}
+
+bool FNsTweenCompactPool::Spawn(int32 BlockId, int32 TargetIndex, float StartValue, float EndValue, float DurationSeconds, ENsTweenEase Ease, ENsTweenCompactFlags Flags)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompactPool::Spawn");
+
+    if (!Blocks.IsValidIndex(BlockId) || !Blocks[BlockId].Values)
+    {
+        return false;
+    }
+
+    FTargetBlock& Block = Blocks[BlockId];
+    if (TargetIndex < 0 || TargetIndex >= Block.Num || Ease >= ENsTweenEase::CustomBezier)
+    {
+        return false;
+    }
+
+    if (NumRecords == Chunks.Num() * ChunkSize)
+    {
+        Chunks.Add(MakeUnique<FChunk>());
+    }
+
+    FNsTweenCompactRecord& Record = At(NumRecords++);
+    Record.StartValue = StartValue;
+    Record.EndValue = EndValue;
+    Record.InvDuration = 1.f / FMath::Max(DurationSeconds, SMALL_NUMBER);
+    Record.Progress = 0;
+    Record.TargetIndex = static_cast<uint32>(TargetIndex);
+    Record.BlockId = static_cast<uint16>(BlockId);
+    Record.Preset = static_cast<uint8>(Ease);
+    Record.Flags = static_cast<uint8>(Flags);
+
+    Block.Values[TargetIndex] = StartValue;
+    return true;
+}
+
+void FNsTweenCompactPool::Tick(float DeltaSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompactPool::Tick");
+
+    if (NumRecords == 0 || DeltaSeconds <= 0.f)
+    {
+        return;
+    }
+
+    const double StepScale = static_cast<double>(DeltaSeconds) * NsTweenCompact::ProgressRange;
+    const uint64 ProgressEnd = static_cast<uint64>(NsTweenCompact::ProgressRange);
+
+    int32 Index = 0;
+    while (Index < NumRecords)
+    {
+        FNsTweenCompactRecord& Record = At(Index);
+        const FTargetBlock& Block = Blocks[Record.BlockId];
+
+        const uint64 Next = static_cast<uint64>(Record.Progress) + static_cast<uint64>(Record.InvDuration * StepScale);
+        if (Next >= ProgressEnd)
+        {
+            Block.Values[Record.TargetIndex] = Record.EndValue;
+            if ((Record.Flags & static_cast<uint8>(ENsTweenCompactFlags::NotifyComplete)) != 0)
+            {
+                PendingCompletions.Emplace(Record.BlockId, static_cast<int32>(Record.TargetIndex));
+            }
+
+            // The swapped-in record has not been ticked yet, so stay on this index.
+            RemoveAtSwap(Index);
+            continue;
+        }
+
+        Record.Progress = static_cast<uint32>(Next);
+        const float Alpha = FNsTweenPolynomialEasing::EvaluatePreset(static_cast<ENsTweenEase>(Record.Preset), Record.Progress * NsTweenCompact::ProgressToAlpha);
+        Block.Values[Record.TargetIndex] = Record.StartValue + (Record.EndValue - Record.StartValue) * Alpha;
+        ++Index;
+    }
+
+    // Fire after the sweep so completion handlers can spawn or unregister freely.
+    if (PendingCompletions.Num() > 0)
+    {
+        TArray<TPair<int32, int32>> Completions = MoveTemp(PendingCompletions);
+        PendingCompletions.Reset();
+
+        for (const TPair<int32, int32>& Completion : Completions)
+        {
+            if (Blocks.IsValidIndex(Completion.Key))
+            {
+                Blocks[Completion.Key].OnComplete.ExecuteIfBound(Completion.Value);
+            }
+        }
+
+        // Hand the scratch allocation back unless a handler queued new completions meanwhile.
+        if (PendingCompletions.Num() == 0)
+        {
+            Completions.Reset();
+            PendingCompletions = MoveTemp(Completions);
+        }
+    }
+}
+
+void FNsTweenCompactPool::Reset()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompactPool::Reset");
+    NumRecords = 0;
+    PendingCompletions.Reset();
+}
+
+void FNsTweenCompactPool::Empty()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompactPool::Empty");
+    NumRecords = 0;
+    Chunks.Empty();
+    Blocks.Empty();
+    FreeBlocks.Empty();
+    PendingCompletions.Empty();
+}
+
+SIZE_T FNsTweenCompactPool::GetAllocatedSize() const
+{
+    return Chunks.Num() * sizeof(FChunk)
+        + Chunks.GetAllocatedSize()
+        + Blocks.GetAllocatedSize()
+        + FreeBlocks.GetAllocatedSize()
+        + PendingCompletions.GetAllocatedSize();
+}
+
+void FNsTweenCompactPool::RemoveAtSwap(int32 Index)
+{
+    const int32 LastIndex = --NumRecords;
+    if (Index != LastIndex)
+    {
+        At(Index) = At(LastIndex);
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Easing/NsTweenEasingFactory.h"
+#include "Easing/NsTweenBezierEasing.h"
+#include "Easing/NsTweenCurveAssetEasingAdapter.h"
+#include "Easing/NsTweenPolynomialEasing.h"
+#include "NsTweenTypeLibrary.h"
+#include "Utils/NsTweenProfiling.h"
+
+namespace NsTweenEasing
+{
+    /** One instance per polynomial preset, built on first use and read-only afterwards. */
+    const TArray<TSharedPtr<IEasingCurve>>& GetPresetEasings()
+    {
+        static const TArray<TSharedPtr<IEasingCurve>> PresetEasings = []()
+        {
+            const int32 PresetCount = static_cast<int32>(ENsTweenEase::CustomBezier);
+            TArray<TSharedPtr<IEasingCurve>> Easings;
+            Easings.Reserve(PresetCount);
+            for (int32 PresetIndex = 0; PresetIndex < PresetCount; ++PresetIndex)
+            {
+                Easings.Add(MakeShared<FNsTweenPolynomialEasing>(static_cast<ENsTweenEase>(PresetIndex)));
+            }
+            return Easings;
+        }();
+
+        return PresetEasings;
+    }
+}
+
+TSharedPtr<IEasingCurve> FNsTweenEasingFactory::Create(const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenEasingFactory::Create");
+    switch (Spec.EasingPreset)
+    {
+        case ENsTweenEase::CustomBezier: return MakeShared<FNsTweenBezierEasing>(Spec.BezierControlPoints);
+        case ENsTweenEase::CurveAsset:   return MakeShared<FNsTweenCurveAssetEasingAdapter>(Spec.CurveAsset);
+        default: break;
+    }
+
+    const TArray<TSharedPtr<IEasingCurve>>& PresetEasings = NsTweenEasing::GetPresetEasings();
+    const int32 PresetIndex = static_cast<int32>(Spec.EasingPreset);
+    if (PresetEasings.IsValidIndex(PresetIndex))
+    {
+        return PresetEasings[PresetIndex];
+    }
+
+    return MakeShared<FNsTweenPolynomialEasing>(Spec.EasingPreset);
+}
@@ -33,6 +33,11 @@ FNsTweenPolynomialEasing::FNsTweenPolynomialEasing(ENsTweenEase InPreset)
 }
 
 float FNsTweenPolynomialEasing::Evaluate(float T) const
+{
+    return EvaluatePreset(Preset, T);
+}
+
+float FNsTweenPolynomialEasing::EvaluatePreset(ENsTweenEase Preset, float T)
 {
     const float X = FMath::Clamp(T, 0.f, 1.f);
 
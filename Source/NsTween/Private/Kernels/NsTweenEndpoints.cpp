@@ -0,0 +1,172 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Kernels/NsTweenEndpoints.h"
+#include "Kernels/NsTweenKernels.h"
+#include "Math/UnrealMathUtility.h"
+
+void FNsTweenRotationEndpoints::Prepare(const FQuat& A, const FQuat& B, ENsTweenRotationMode InMode)
+{
+    Mode = InMode;
+    StartQuat = A.GetNormalized();
+    EndQuat = B.GetNormalized();
+
+    // Keep both ends on the same hemisphere so nlerp takes the short way round.
+    if ((StartQuat | EndQuat) < 0.0)
+    {
+        EndQuat = EndQuat * -1.0;
+    }
+
+    if (Mode == ENsTweenRotationMode::ShortestEuler)
+    {
+        StartRotator = StartQuat.Rotator();
+        DeltaRotator = (EndQuat.Rotator() - StartRotator).GetNormalized();
+    }
+}
+
+void FNsTweenRotationEndpoints::Prepare(const FRotator& A, const FRotator& B, ENsTweenRotationMode InMode)
+{
+    if (InMode == ENsTweenRotationMode::ShortestEuler)
+    {
+        Mode = InMode;
+        StartRotator = A;
+        DeltaRotator = (B - A).GetNormalized();
+        return;
+    }
+
+    Prepare(A.Quaternion(), B.Quaternion(), InMode);
+}
+
+FQuat FNsTweenRotationEndpoints::EvaluateQuat(float Alpha) const
+{
+    switch (Mode)
+    {
+        case ENsTweenRotationMode::Nlerp:
+        {
+            // A quaternion is exactly one register pass of the uniform double kernel.
+            static_assert(sizeof(FQuat) == 4 * sizeof(double), "FQuat must be four packed doubles.");
+            FQuat Result;
+            FNsTweenKernels::LerpDoublesUniform(&StartQuat.X, &EndQuat.X, Alpha, &Result.X, 4);
+            Result.Normalize();
+            return Result;
+        }
+        case ENsTweenRotationMode::ShortestEuler:
+            return (StartRotator + DeltaRotator * Alpha).Quaternion();
+        case ENsTweenRotationMode::Slerp:
+        default:
+            return FNsTweenKernels::SlerpQuat(StartQuat, EndQuat, Alpha);
+    }
+}
+
+FRotator FNsTweenRotationEndpoints::EvaluateRotator(float Alpha) const
+{
+    if (Mode == ENsTweenRotationMode::ShortestEuler)
+    {
+        return StartRotator + DeltaRotator * Alpha;
+    }
+
+    return EvaluateQuat(Alpha).Rotator();
+}
+
+void FNsTweenColorEndpoints::Prepare(const FLinearColor& A, const FLinearColor& B, ENsTweenColorMode InMode)
+{
+    Mode = InMode;
+
+    switch (Mode)
+    {
+        case ENsTweenColorMode::HSV:
+        {
+            Start = A.LinearRGBToHSV();
+            End = B.LinearRGBToHSV();
+            Start.A = A.A;
+            End.A = B.A;
+
+            // Unwrap the hue once so the per-frame lerp always takes the shortest path.
+            if (FMath::Abs(Start.R - End.R) > 180.f)
+            {
+                if (End.R > Start.R)
+                {
+                    Start.R += 360.f;
+                }
+                else
+                {
+                    End.R += 360.f;
+                }
+            }
+            break;
+        }
+        case ENsTweenColorMode::OkLab:
+            Start = LinearToOkLab(A);
+            End = LinearToOkLab(B);
+            break;
+        case ENsTweenColorMode::RGB:
+        default:
+            Start = A;
+            End = B;
+            break;
+    }
+}
+
+FLinearColor FNsTweenColorEndpoints::Evaluate(float Alpha) const
+{
+    // The working-space color is exactly one register pass of the uniform float kernel.
+    static_assert(sizeof(FLinearColor) == 4 * sizeof(float), "FLinearColor must be four packed floats.");
+    FLinearColor Blended;
+    FNsTweenKernels::LerpFloatsUniform(&Start.R, &End.R, Alpha, &Blended.R, 4);
+
+    switch (Mode)
+    {
+        case ENsTweenColorMode::HSV:
+        {
+            FLinearColor HSV = Blended;
+            HSV.R = FMath::Fmod(HSV.R, 360.f);
+            if (HSV.R < 0.f)
+            {
+                HSV.R += 360.f;
+            }
+
+            FLinearColor Result = HSV.HSVToLinearRGB();
+            Result.A = Blended.A;
+            return Result;
+        }
+        case ENsTweenColorMode::OkLab:
+            return OkLabToLinear(Blended);
+        case ENsTweenColorMode::RGB:
+        default:
+            return Blended;
+    }
+}
+
+FLinearColor FNsTweenColorEndpoints::LinearToOkLab(const FLinearColor& Color)
+{
+    const float L = 0.4122214708f * Color.R + 0.5363325363f * Color.G + 0.0514459929f * Color.B;
+    const float M = 0.2119034982f * Color.R + 0.6806995451f * Color.G + 0.1073969566f * Color.B;
+    const float S = 0.0883024619f * Color.R + 0.2817188376f * Color.G + 0.6299787005f * Color.B;
+
+    // Signed cube root keeps out-of-gamut (negative) components invertible.
+    const float LRoot = FMath::Sign(L) * FMath::Pow(FMath::Abs(L), 1.f / 3.f);
+    const float MRoot = FMath::Sign(M) * FMath::Pow(FMath::Abs(M), 1.f / 3.f);
+    const float SRoot = FMath::Sign(S) * FMath::Pow(FMath::Abs(S), 1.f / 3.f);
+
+    return FLinearColor(
+        0.2104542553f * LRoot + 0.7936177850f * MRoot - 0.0040720468f * SRoot,
+        1.9779984951f * LRoot - 2.4285922050f * MRoot + 0.4505937099f * SRoot,
+        0.0259040371f * LRoot + 0.7827717662f * MRoot - 0.8086757660f * SRoot,
+        Color.A);
+}
+
+FLinearColor FNsTweenColorEndpoints::OkLabToLinear(const FLinearColor& Lab)
+{
+    const float LRoot = Lab.R + 0.3963377774f * Lab.G + 0.2158037573f * Lab.B;
+    const float MRoot = Lab.R - 0.1055613458f * Lab.G - 0.0638541728f * Lab.B;
+    const float SRoot = Lab.R - 0.0894841775f * Lab.G - 1.2914855480f * Lab.B;
+
+    const float L = LRoot * LRoot * LRoot;
+    const float M = MRoot * MRoot * MRoot;
+    const float S = SRoot * SRoot * SRoot;
+
+    return FLinearColor(
+        4.0767416621f * L - 3.3077115913f * M + 0.2309699292f * S,
+        -1.2684380046f * L + 2.6097574011f * M - 0.3413193965f * S,
+        -0.0041960863f * L - 0.7034186147f * M + 1.7076147010f * S,
+        Lab.A);
+}
@@ -0,0 +1,242 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Kernels/NsTweenKernels.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+
+namespace NsTweenKernels
+{
+    /** Below this angle slerp degenerates and a plain lerp is both faster and more stable. */
+    constexpr double SlerpLerpThreshold = 0.9999;
+
+    /** Splats four per-element float alphas into a double register. */
+    FORCEINLINE VectorRegister4Double LoadAlphaDouble(const float* Alpha)
+    {
+        return MakeVectorRegisterDouble(static_cast<double>(Alpha[0]), static_cast<double>(Alpha[1]), static_cast<double>(Alpha[2]), static_cast<double>(Alpha[3]));
+    }
+}
+
+void FNsTweenKernels::ComputeSlerpWeights(double CosOmega, double Alpha, double& OutWeightA, double& OutWeightB)
+{
+    // Flip the second quaternion when the dot is negative so we always travel the shortest arc.
+    const double Sign = (CosOmega >= 0.0) ? 1.0 : -1.0;
+    const double AbsCos = CosOmega * Sign;
+
+    if (AbsCos < NsTweenKernels::SlerpLerpThreshold)
+    {
+        const double Omega = FMath::Acos(AbsCos);
+        const double InvSin = 1.0 / FMath::Sin(Omega);
+        OutWeightA = FMath::Sin((1.0 - Alpha) * Omega) * InvSin;
+        OutWeightB = FMath::Sin(Alpha * Omega) * InvSin * Sign;
+    }
+    else
+    {
+        OutWeightA = 1.0 - Alpha;
+        OutWeightB = Alpha * Sign;
+    }
+}
+
+void FNsTweenKernels::LerpFloats(const float* Start, const float* End, const float* Alpha, float* Out, int32 Count)
+{
+    int32 Index = 0;
+    for (; Index + LaneCount <= Count; Index += LaneCount)
+    {
+        const VectorRegister4Float VStart = VectorLoad(Start + Index);
+        const VectorRegister4Float VEnd = VectorLoad(End + Index);
+        const VectorRegister4Float VAlpha = VectorLoad(Alpha + Index);
+        VectorStore(VectorMultiplyAdd(VectorSubtract(VEnd, VStart), VAlpha, VStart), Out + Index);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = Start[Index] + (End[Index] - Start[Index]) * Alpha[Index];
+    }
+}
+
+void FNsTweenKernels::LerpDoubles(const double* Start, const double* End, const float* Alpha, double* Out, int32 Count)
+{
+    int32 Index = 0;
+    for (; Index + LaneCount <= Count; Index += LaneCount)
+    {
+        const VectorRegister4Double VStart = VectorLoad(Start + Index);
+        const VectorRegister4Double VEnd = VectorLoad(End + Index);
+        const VectorRegister4Double VAlpha = NsTweenKernels::LoadAlphaDouble(Alpha + Index);
+        VectorStore(VectorMultiplyAdd(VectorSubtract(VEnd, VStart), VAlpha, VStart), Out + Index);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = Start[Index] + (End[Index] - Start[Index]) * static_cast<double>(Alpha[Index]);
+    }
+}
+
+void FNsTweenKernels::LerpFloatsUniform(const float* Start, const float* End, float Alpha, float* Out, int32 Count)
+{
+    const VectorRegister4Float VAlpha = VectorSetFloat1(Alpha);
+    int32 Index = 0;
+    for (; Index + LaneCount <= Count; Index += LaneCount)
+    {
+        const VectorRegister4Float VStart = VectorLoad(Start + Index);
+        const VectorRegister4Float VEnd = VectorLoad(End + Index);
+        VectorStore(VectorMultiplyAdd(VectorSubtract(VEnd, VStart), VAlpha, VStart), Out + Index);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = Start[Index] + (End[Index] - Start[Index]) * Alpha;
+    }
+}
+
+void FNsTweenKernels::LerpDoublesUniform(const double* Start, const double* End, float Alpha, double* Out, int32 Count)
+{
+    const double DAlpha = static_cast<double>(Alpha);
+    const VectorRegister4Double VAlpha = MakeVectorRegisterDouble(DAlpha, DAlpha, DAlpha, DAlpha);
+    int32 Index = 0;
+    for (; Index + LaneCount <= Count; Index += LaneCount)
+    {
+        const VectorRegister4Double VStart = VectorLoad(Start + Index);
+        const VectorRegister4Double VEnd = VectorLoad(End + Index);
+        VectorStore(VectorMultiplyAdd(VectorSubtract(VEnd, VStart), VAlpha, VStart), Out + Index);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = Start[Index] + (End[Index] - Start[Index]) * DAlpha;
+    }
+}
+
+void FNsTweenKernels::LerpVectors(const FNsTweenVectorSoA& Start, const FNsTweenVectorSoA& End, const float* Alpha, const FNsTweenVectorSoA& Out, int32 Count)
+{
+    LerpDoubles(Start.X, End.X, Alpha, Out.X, Count);
+    LerpDoubles(Start.Y, End.Y, Alpha, Out.Y, Count);
+    LerpDoubles(Start.Z, End.Z, Alpha, Out.Z, Count);
+}
+
+template <typename TAlphaAt>
+void FNsTweenKernels::SlerpQuatsImpl(const FNsTweenQuatSoA& Start, const FNsTweenQuatSoA& End, TAlphaAt AlphaAt, const FNsTweenQuatSoA& Out, int32 Count)
+{
+    int32 Index = 0;
+    for (; Index + LaneCount <= Count; Index += LaneCount)
+    {
+        const VectorRegister4Double AX = VectorLoad(Start.X + Index);
+        const VectorRegister4Double AY = VectorLoad(Start.Y + Index);
+        const VectorRegister4Double AZ = VectorLoad(Start.Z + Index);
+        const VectorRegister4Double AW = VectorLoad(Start.W + Index);
+        const VectorRegister4Double BX = VectorLoad(End.X + Index);
+        const VectorRegister4Double BY = VectorLoad(End.Y + Index);
+        const VectorRegister4Double BZ = VectorLoad(End.Z + Index);
+        const VectorRegister4Double BW = VectorLoad(End.W + Index);
+
+        // Four dot products at once, one per lane.
+        VectorRegister4Double Dot = VectorMultiply(AX, BX);
+        Dot = VectorMultiplyAdd(AY, BY, Dot);
+        Dot = VectorMultiplyAdd(AZ, BZ, Dot);
+        Dot = VectorMultiplyAdd(AW, BW, Dot);
+
+        // The arc weights need acos/sin per lane; everything around them stays in registers.
+        alignas(32) double Dots[LaneCount];
+        alignas(32) double WeightsA[LaneCount];
+        alignas(32) double WeightsB[LaneCount];
+        VectorStore(Dot, Dots);
+        for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+        {
+            ComputeSlerpWeights(Dots[Lane], static_cast<double>(AlphaAt(Index + Lane)), WeightsA[Lane], WeightsB[Lane]);
+        }
+
+        const VectorRegister4Double WA = VectorLoad(WeightsA);
+        const VectorRegister4Double WB = VectorLoad(WeightsB);
+        const VectorRegister4Double RX = VectorMultiplyAdd(BX, WB, VectorMultiply(AX, WA));
+        const VectorRegister4Double RY = VectorMultiplyAdd(BY, WB, VectorMultiply(AY, WA));
+        const VectorRegister4Double RZ = VectorMultiplyAdd(BZ, WB, VectorMultiply(AZ, WA));
+        const VectorRegister4Double RW = VectorMultiplyAdd(BW, WB, VectorMultiply(AW, WA));
+
+        VectorRegister4Double LengthSquared = VectorMultiply(RX, RX);
+        LengthSquared = VectorMultiplyAdd(RY, RY, LengthSquared);
+        LengthSquared = VectorMultiplyAdd(RZ, RZ, LengthSquared);
+        LengthSquared = VectorMultiplyAdd(RW, RW, LengthSquared);
+        const VectorRegister4Double InvLength = VectorReciprocalSqrt(LengthSquared);
+
+        VectorStore(VectorMultiply(RX, InvLength), Out.X + Index);
+        VectorStore(VectorMultiply(RY, InvLength), Out.Y + Index);
+        VectorStore(VectorMultiply(RZ, InvLength), Out.Z + Index);
+        VectorStore(VectorMultiply(RW, InvLength), Out.W + Index);
+    }
+
+    for (; Index < Count; ++Index)
+    {
+        const FQuat Result = SlerpQuat(
+            FQuat(Start.X[Index], Start.Y[Index], Start.Z[Index], Start.W[Index]),
+            FQuat(End.X[Index], End.Y[Index], End.Z[Index], End.W[Index]),
+            AlphaAt(Index));
+
+        Out.X[Index] = Result.X;
+        Out.Y[Index] = Result.Y;
+        Out.Z[Index] = Result.Z;
+        Out.W[Index] = Result.W;
+    }
+}
+
+void FNsTweenKernels::SlerpQuats(const FNsTweenQuatSoA& Start, const FNsTweenQuatSoA& End, const float* Alpha, const FNsTweenQuatSoA& Out, int32 Count)
+{
+    SlerpQuatsImpl(Start, End, [Alpha](int32 Index) { return Alpha[Index]; }, Out, Count);
+}
+
+void FNsTweenKernels::SlerpQuatsUniform(const FNsTweenQuatSoA& Start, const FNsTweenQuatSoA& End, float Alpha, const FNsTweenQuatSoA& Out, int32 Count)
+{
+    SlerpQuatsImpl(Start, End, [Alpha](int32) { return Alpha; }, Out, Count);
+}
+
+void FNsTweenKernels::LerpTransforms(const FNsTweenTransformSoA& Start, const FNsTweenTransformSoA& End, const float* Alpha, const FNsTweenTransformSoA& Out, int32 Count)
+{
+    LerpVectors(Start.Translation, End.Translation, Alpha, Out.Translation, Count);
+    SlerpQuats(Start.Rotation, End.Rotation, Alpha, Out.Rotation, Count);
+    LerpVectors(Start.Scale, End.Scale, Alpha, Out.Scale, Count);
+}
+
+void FNsTweenKernels::LerpTransformsUniform(const FNsTweenTransformSoA& Start, const FNsTweenTransformSoA& End, float Alpha, const FNsTweenTransformSoA& Out, int32 Count)
+{
+    LerpDoublesUniform(Start.Translation.X, End.Translation.X, Alpha, Out.Translation.X, Count);
+    LerpDoublesUniform(Start.Translation.Y, End.Translation.Y, Alpha, Out.Translation.Y, Count);
+    LerpDoublesUniform(Start.Translation.Z, End.Translation.Z, Alpha, Out.Translation.Z, Count);
+    SlerpQuatsUniform(Start.Rotation, End.Rotation, Alpha, Out.Rotation, Count);
+    LerpDoublesUniform(Start.Scale.X, End.Scale.X, Alpha, Out.Scale.X, Count);
+    LerpDoublesUniform(Start.Scale.Y, End.Scale.Y, Alpha, Out.Scale.Y, Count);
+    LerpDoublesUniform(Start.Scale.Z, End.Scale.Z, Alpha, Out.Scale.Z, Count);
+}
+
+FVector FNsTweenKernels::LerpVector(const FVector& A, const FVector& B, float Alpha)
+{
+    const VectorRegister4Double VA = VectorLoadFloat3(&A.X);
+    const VectorRegister4Double VB = VectorLoadFloat3(&B.X);
+    const double DAlpha = static_cast<double>(Alpha);
+    const VectorRegister4Double VAlpha = MakeVectorRegisterDouble(DAlpha, DAlpha, DAlpha, DAlpha);
+
+    FVector Result;
+    VectorStoreFloat3(VectorMultiplyAdd(VectorSubtract(VB, VA), VAlpha, VA), &Result.X);
+    return Result;
+}
+
+FQuat FNsTweenKernels::SlerpQuat(const FQuat& A, const FQuat& B, float Alpha)
+{
+    const VectorRegister4Double VA = VectorLoad(&A.X);
+    const VectorRegister4Double VB = VectorLoad(&B.X);
+
+    double WeightA = 0.0;
+    double WeightB = 0.0;
+    ComputeSlerpWeights(A | B, static_cast<double>(Alpha), WeightA, WeightB);
+
+    const VectorRegister4Double Blended = VectorMultiplyAdd(VB, MakeVectorRegisterDouble(WeightB, WeightB, WeightB, WeightB), VectorMultiply(VA, MakeVectorRegisterDouble(WeightA, WeightA, WeightA, WeightA)));
+    const VectorRegister4Double Normalized = VectorMultiply(Blended, VectorReciprocalSqrt(VectorDot4(Blended, Blended)));
+
+    FQuat Result;
+    VectorStore(Normalized, &Result.X);
+    return Result;
+}
+
+FTransform FNsTweenKernels::LerpTransform(const FTransform& A, const FTransform& B, float Alpha)
+{
+    return FTransform(
+        SlerpQuat(A.GetRotation(), B.GetRotation(), Alpha),
+        LerpVector(A.GetTranslation(), B.GetTranslation(), Alpha),
+        LerpVector(A.GetScale3D(), B.GetScale3D(), Alpha));
+}
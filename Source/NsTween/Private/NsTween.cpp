@@ -1,11 +1,15 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "NsTween.h"
+#include "Clock/NsTweenClock.h"
 #include "Engine/Engine.h"
 #include "Interfaces/IEasingCurve.h"
 #include "Interfaces/ITweenValue.h"
 #include "Math/UnrealMathUtility.h"
+#include "NsTweenSubsystem.h"
+#include "Sequence/NsTweenCompiledSequence.h"
 #include "Utils/NsTweenProfiling.h"
+#include "ValueStrategies/TweenValue_Sequence.h"
 
 FNsTweenBuilder FNsTween::Play(FNsTweenSpec Spec, TFunction<TSharedPtr<ITweenValue>()> StrategyFactory)
 {
@@ -13,40 +17,153 @@ FNsTweenBuilder FNsTween::Play(FNsTweenSpec Spec, TFunction<TSharedPtr<ITweenVal
     return FNsTweenBuilder(MoveTemp(Spec), MoveTemp(StrategyFactory));
 }
 
-FNsTween::FNsTween(const FNsTweenHandle& InHandle, FNsTweenSpec InSpec, TSharedPtr<ITweenValue> InStrategy, TSharedPtr<IEasingCurve> InEasing)
-    : Handle(InHandle)
-    , Spec(MoveTemp(InSpec))
-    , Strategy(MoveTemp(InStrategy))
-    , Easing(MoveTemp(InEasing))
+FNsTweenBuilder FNsTween::PlaySequence(const UNsTweenSequence* Sequence, TArray<TSharedPtr<ITweenValue>> Bindings)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::Ctor");
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::PlaySequence");
+    if (!Sequence)
+    {
+        return FNsTweenBuilder();
+    }
+
+    // Only the shared timeline is read; the asset's spec array is not walked per instance.
+    TSharedRef<const FNsTweenCompiledSequence> Compiled = Sequence->GetCompiled();
+    if (Compiled->NumItems() == 0 || Bindings.Num() != Compiled->NumItems())
+    {
+        return FNsTweenBuilder();
+    }
+
+    for (int32 SegmentIndex = 0; SegmentIndex < Compiled->NumItems(); ++SegmentIndex)
+    {
+        if (ITweenValue* Binding = Bindings[Compiled->GetSegment(SegmentIndex).Item].Get())
+        {
+            Binding->Prepare(Compiled->MakeBindingSpec(SegmentIndex));
+        }
+    }
+
+    FNsTweenColdData* Record = ReserveRecord();
+    if (!Record)
+    {
+        return FNsTweenBuilder();
+    }
+
+    // The playhead advances linearly; each item applies its own easing inside its segment.
+    const float Duration = Compiled->GetDuration();
+    Record->EmplaceStrategy<FTweenValue_Sequence>(MoveTemp(Compiled), MoveTemp(Bindings));
+    return FNsTweenBuilder(MakeSpec(Duration, ENsTweenEase::Linear), Record->GetHandle());
+}
+
+FNsTweenColdData* FNsTween::ReserveRecord()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::ReserveRecord");
+    if (UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem())
+    {
+        return Subsystem->ReserveTween();
+    }
+
+    return nullptr;
+}
+
+FNsTweenSpec FNsTween::MakeSpec(float DurationSeconds, ENsTweenEase Ease)
+{
+    FNsTweenSpec Spec;
+    Spec.DurationSeconds = FMath::Max(DurationSeconds, 0.f);
+    Spec.DelaySeconds = 0.f;
+    Spec.TimeScale = 1.f;
+    Spec.WrapMode = ENsTweenWrapMode::Once;
+    Spec.LoopCount = 0;
+    Spec.Direction = ENsTweenDirection::Forward;
+    Spec.EasingPreset = Ease;
+    return Spec;
+}
+
+void FNsTweenColdData::SetStrategy(TSharedPtr<ITweenValue> InStrategy)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenColdData::SetStrategy");
+    Strategy.SetShared(MoveTemp(InStrategy));
+}
+
+void FNsTweenColdData::Reset()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenColdData::Reset");
+
+    // Tear down the previous tween's runtime pieces so the record can be handed out again.
+    Strategy.Reset();
+    Easing.Reset();
+    Spec = FNsTweenSpec();
+    Handle.Reset();
+    LiveIndex = INDEX_NONE;
+}
+
+FNsTween::FNsTween()
+    : bActive(false)
+    , bPaused(false)
+    , bInitialized(false)
+    , bPlayingForward(true)
+    , bStartBackward(false)
+    , bEnforceOwnerLifetime(false)
+    , bHasUpdateCallback(false)
+{
+}
+
+void FNsTween::Start(FNsTweenColdData& InCold, FNsTweenSpec&& InSpec, TSharedPtr<IEasingCurve> InEasing)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::Start");
+
+    FNsTweenSpec& Spec = InCold.Spec;
+    Spec = MoveTemp(InSpec);
+    InCold.Easing = MoveTemp(InEasing);
 
     Spec.DelaySeconds = FMath::Max(0.f, Spec.DelaySeconds);
     Spec.DurationSeconds = FMath::Max(Spec.DurationSeconds, SMALL_NUMBER);
     Spec.TimeScale = FMath::Max(Spec.TimeScale, 0.f);
     Spec.LoopCount = FMath::Max(Spec.LoopCount, 0);
 
+    // Convert endpoints for the selected interpolation modes once, so ticking only pays for the blend.
+    if (InCold.Strategy.IsValid())
+    {
+        InCold.Strategy->Prepare(Spec);
+    }
+
+    Cold = &InCold;
+    Strategy = InCold.Strategy.Get();
+    Easing = InCold.Easing.Get();
+    Handle = InCold.Handle;
+    Clock = Spec.Clock;
+
+    DurationSeconds = Spec.DurationSeconds;
+    TimeScale = Spec.TimeScale;
     DelayRemaining = Spec.DelaySeconds;
-    CycleTime = (Spec.Direction == ENsTweenDirection::Forward) ? 0.f : Spec.DurationSeconds;
-    bPlayingForward = (Spec.Direction != ENsTweenDirection::Backward);
-    bStartBackward = (Spec.Direction == ENsTweenDirection::Backward);
+    LoopCount = Spec.LoopCount;
+    WrapMode = Spec.WrapMode;
+    Direction = Spec.Direction;
+    CycleTime = (Direction == ENsTweenDirection::Forward) ? 0.f : DurationSeconds;
+    CompletedCycles = 0;
+    CompletedPingPongPairs = 0;
+
+    bActive = true;
+    bPaused = false;
+    bInitialized = false;
+    bPlayingForward = (Direction != ENsTweenDirection::Backward);
+    bStartBackward = (Direction == ENsTweenDirection::Backward);
+    bEnforceOwnerLifetime = Spec.bEnforceOwnerLifetime;
+    bHasUpdateCallback = Spec.OnUpdate.IsBound();
 }
 
-bool FNsTween::Tick(float DeltaSeconds)
+bool FNsTween::BeginTick()
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::Tick");
     // Bail out immediately if the tween is already completed, paused, or missing runtime pieces.
-    if (!bActive || bPaused || !Strategy.IsValid() || !Easing.IsValid())
+    if (!bActive || bPaused || !Strategy || !Easing)
     {
-        bActive = bActive && Strategy.IsValid() && Easing.IsValid();
-        return bActive;
+        bActive = bActive && Strategy && Easing;
+        return false;
     }
 
-    if (Spec.bEnforceOwnerLifetime && !Spec.Owner.IsValid())
+    // Owner lifetime is the only per-frame read of the cold record, and only for tweens that opted in.
+    if (bEnforceOwnerLifetime && !Cold->Spec.Owner.IsValid())
     {
         bActive = false;
-        Strategy.Reset();
-        Easing.Reset();
+        Strategy = nullptr;
+        Easing = nullptr;
         return false;
     }
 
@@ -61,8 +178,26 @@ bool FNsTween::Tick(float DeltaSeconds)
         bInitialized = true;
     }
 
+    return true;
+}
+
+bool FNsTween::Tick(float DeltaSeconds)
+{
+    float LeftoverSeconds = 0.f;
+    return Tick(DeltaSeconds, LeftoverSeconds);
+}
+
+bool FNsTween::Tick(float DeltaSeconds, float& OutLeftoverSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::Tick");
+    OutLeftoverSeconds = -1.f;
+    if (!BeginTick())
+    {
+        return bActive;
+    }
+
     // Respect the time scale so tweens can speed up or slow down deterministically.
-    float ScaledDelta = DeltaSeconds * Spec.TimeScale;
+    float ScaledDelta = DeltaSeconds * TimeScale;
     if (ScaledDelta <= SMALL_NUMBER)
     {
         return true;
@@ -82,7 +217,7 @@ bool FNsTween::Tick(float DeltaSeconds)
     }
 
     float RemainingTime = ScaledDelta;
-    const float LocalDuration = Spec.DurationSeconds;
+    const float LocalDuration = DurationSeconds;
 
     while (RemainingTime > SMALL_NUMBER && bActive)
     {
@@ -111,6 +246,8 @@ bool FNsTween::Tick(float DeltaSeconds)
 
         if (!HandleBoundary(RemainingTime))
         {
+            // Chained successors start with the rest of the frame, in real time.
+            OutLeftoverSeconds = RemainingTime / TimeScale;
             return false;
         }
     }
@@ -118,6 +255,58 @@ bool FNsTween::Tick(float DeltaSeconds)
     return bActive;
 }
 
+bool FNsTween::TickOnClock(FNsTweenClockFrame Frame, float& OutLeftoverSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::TickOnClock");
+    OutLeftoverSeconds = -1.f;
+    // A tween joining a running clock snaps to it on its first tick; afterwards it only applies when the clock moved.
+    const bool bFirstTick = !bInitialized;
+    if (!BeginTick())
+    {
+        return bActive;
+    }
+
+    // Events are rare, so the cold record is only touched on frames that have them.
+    for (int32 Event = 0; Event < Frame.LoopEvents; ++Event)
+    {
+        Cold->Spec.OnLoop.ExecuteIfBound();
+    }
+    for (int32 Event = 0; Event < Frame.PingPongEvents; ++Event)
+    {
+        Cold->Spec.OnPingPong.ExecuteIfBound();
+    }
+
+    if (Frame.bFinished)
+    {
+        Complete();
+        OutLeftoverSeconds = 0.f;
+        return false;
+    }
+
+    if (bFirstTick || Frame.bMoved)
+    {
+        ApplyAlpha(Frame.LinearAlpha);
+    }
+
+    return bActive;
+}
+
+void FNsTween::ApplyStart()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::ApplyStart");
+    if (!BeginTick())
+    {
+        return;
+    }
+
+    if (Clock.IsValid() || DelayRemaining > SMALL_NUMBER)
+    {
+        return;
+    }
+
+    Apply(CycleTime);
+}
+
 void FNsTween::Cancel(bool bApplyFinal)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::Cancel");
@@ -127,17 +316,14 @@ void FNsTween::Cancel(bool bApplyFinal)
         return;
     }
 
-    if (bApplyFinal)
+    if (bApplyFinal && Strategy)
     {
-        if (Strategy.IsValid())
-        {
-            Strategy->ApplyFinal();
-        }
+        Strategy->ApplyFinal();
     }
 
-    if (Spec.OnComplete.IsBound())
+    if (Cold && Cold->Spec.OnComplete.IsBound())
     {
-        Spec.OnComplete.Execute();
+        Cold->Spec.OnComplete.Execute();
     }
 
     bActive = false;
@@ -149,104 +335,147 @@ void FNsTween::SetPaused(bool bInPaused)
     bPaused = bInPaused;
 }
 
+void FNsTween::SetTimeScale(float InTimeScale)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::SetTimeScale");
+    TimeScale = FMath::Max(InTimeScale, 0.f);
+    if (Cold)
+    {
+        Cold->Spec.TimeScale = TimeScale;
+    }
+}
+
+void FNsTween::SetDuration(float InDurationSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::SetDuration");
+    const float Progress = CycleTime / DurationSeconds;
+    DurationSeconds = FMath::Max(InDurationSeconds, SMALL_NUMBER);
+    CycleTime = Progress * DurationSeconds;
+    if (Cold)
+    {
+        Cold->Spec.DurationSeconds = DurationSeconds;
+    }
+}
+
+void FNsTween::SetEasing(TSharedPtr<IEasingCurve> InEasing)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::SetEasing");
+    if (!Cold || !InEasing.IsValid())
+    {
+        return;
+    }
+
+    Cold->Easing = MoveTemp(InEasing);
+    Easing = Cold->Easing.Get();
+}
+
+bool FNsTween::SetEndValue(const FNsTweenValue& NewEnd, float LinearAlpha, bool bVelocityContinuous)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::SetEndValue");
+    if (!Strategy || !Easing)
+    {
+        return false;
+    }
+
+    return Strategy->SetEndValue(NewEnd, Cold->Spec, Easing->Evaluate(LinearAlpha), bVelocityContinuous);
+}
+
+bool FNsTween::HandOverTo(FNsTween& Next, float LinearAlpha) const
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::HandOverTo");
+    if (!Strategy || !Easing || !Next.Strategy || !Next.Cold)
+    {
+        return false;
+    }
+
+    FNsTweenValue Current;
+    return Strategy->SampleValue(Easing->Evaluate(LinearAlpha), Current) && Next.Strategy->SetStartValue(Current, Next.Cold->Spec);
+}
+
 void FNsTween::Apply(float InCycleTime)
+{
+    ApplyAlpha(FMath::Clamp(InCycleTime / DurationSeconds, 0.f, 1.f));
+}
+
+void FNsTween::ApplyAlpha(float LinearAlpha)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::Apply");
     // Guard against misconfigured tweens that somehow lost their runtime strategy.
-    if (!Strategy.IsValid() || !Easing.IsValid())
+    if (!Strategy || !Easing)
     {
         return;
     }
 
-    const float Duration = Spec.DurationSeconds;
-    const float LinearAlpha = FMath::Clamp(InCycleTime / Duration, 0.f, 1.f);
     const float EasedAlpha = Easing->Evaluate(LinearAlpha);
 
     Strategy->Apply(EasedAlpha);
-    if (Spec.OnUpdate.IsBound())
+    if (bHasUpdateCallback)
+    {
+        Cold->Spec.OnUpdate.ExecuteIfBound(EasedAlpha);
+    }
+}
+
+void FNsTween::Complete()
+{
+    if (Strategy)
+    {
+        Strategy->ApplyFinal();
+    }
+
+    if (Cold->Spec.OnComplete.IsBound())
     {
-        Spec.OnUpdate.Execute(EasedAlpha);
+        Cold->Spec.OnComplete.Execute();
     }
+
+    bActive = false;
 }
 
 bool FNsTween::HandleBoundary(float& RemainingTime)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::HandleBoundary");
 
-    const ENsTweenWrapMode WrapMode = Spec.WrapMode;
-
     if (WrapMode == ENsTweenWrapMode::Once)
     {
-        if (Strategy.IsValid())
-        {
-            Strategy->ApplyFinal();
-        }
-
-        if (Spec.OnComplete.IsBound())
-        {
-            Spec.OnComplete.Execute();
-        }
-
-        bActive = false;
+        Complete();
         return false;
     }
 
     if (WrapMode == ENsTweenWrapMode::Loop)
     {
         ++CompletedCycles;
-        if (Spec.OnLoop.IsBound())
+        if (Cold->Spec.OnLoop.IsBound())
         {
-            Spec.OnLoop.Execute();
+            Cold->Spec.OnLoop.Execute();
         }
 
-        if (Spec.LoopCount > 0 && CompletedCycles >= Spec.LoopCount)
+        if (LoopCount > 0 && CompletedCycles >= LoopCount)
         {
-            if (Strategy.IsValid())
-            {
-                Strategy->ApplyFinal();
-            }
-
-            if (Spec.OnComplete.IsBound())
-            {
-                Spec.OnComplete.Execute();
-            }
-
-            bActive = false;
+            Complete();
             return false;
         }
 
         CycleTime = 0.f;
-        bPlayingForward = (Spec.Direction != ENsTweenDirection::Backward);
+        bPlayingForward = (Direction != ENsTweenDirection::Backward);
     }
     else if (WrapMode == ENsTweenWrapMode::PingPong)
     {
         bPlayingForward = !bPlayingForward;
-        if (Spec.OnPingPong.IsBound())
+        if (Cold->Spec.OnPingPong.IsBound())
         {
-            Spec.OnPingPong.Execute();
+            Cold->Spec.OnPingPong.Execute();
         }
 
         if (!bPlayingForward)
         {
             ++CompletedPingPongPairs;
         }
-        else if (Spec.LoopCount > 0 && CompletedPingPongPairs >= Spec.LoopCount)
+        else if (LoopCount > 0 && CompletedPingPongPairs >= LoopCount)
         {
-            if (Strategy.IsValid())
-            {
-                Strategy->ApplyFinal();
-            }
-
-            if (Spec.OnComplete.IsBound())
-            {
-                Spec.OnComplete.Execute();
-            }
-
-            bActive = false;
+            Complete();
             return false;
         }
 
-        CycleTime = bPlayingForward ? 0.f : Spec.DurationSeconds;
+        CycleTime = bPlayingForward ? 0.f : DurationSeconds;
     }
 
     if (RemainingTime < 0.f)
@@ -255,4 +484,3 @@ bool FNsTween::HandleBoundary(float& RemainingTime)
     }
     return true;
 }
-
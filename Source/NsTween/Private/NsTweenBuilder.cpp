@@ -10,6 +10,20 @@ FNsTweenBuilder::FNsTweenBuilder(FNsTweenSpec&& InSpec, TFunction<TSharedPtr<ITw
     : Spec(MoveTemp(InSpec))
     , StrategyFactory(MoveTemp(InStrategyFactory))
     , bHasSpec(true)
+{
+    InitializeFromSpec();
+}
+
+FNsTweenBuilder::FNsTweenBuilder(FNsTweenSpec&& InSpec, const FNsTweenHandle& InReservedHandle)
+    : Spec(MoveTemp(InSpec))
+    , Handle(InReservedHandle)
+    , bHasSpec(true)
+    , bReserved(true)
+{
+    InitializeFromSpec();
+}
+
+void FNsTweenBuilder::InitializeFromSpec()
 {
     bLooping = (Spec.WrapMode == ENsTweenWrapMode::Loop) || (Spec.LoopCount != 0);
     bPingPong = (Spec.WrapMode == ENsTweenWrapMode::PingPong);
@@ -20,9 +34,54 @@ FNsTweenBuilder::FNsTweenBuilder(FNsTweenSpec&& InSpec, TFunction<TSharedPtr<ITw
     UpdateWrapMode();
 }
 
-FNsTweenBuilder::FNsTweenBuilder(FNsTweenBuilder&& Other) noexcept = default;
+FNsTweenBuilder::FNsTweenBuilder(FNsTweenBuilder&& Other) noexcept
+    : Spec(MoveTemp(Other.Spec))
+    , StrategyFactory(MoveTemp(Other.StrategyFactory))
+    , CompleteCallback(MoveTemp(Other.CompleteCallback))
+    , LoopCallback(MoveTemp(Other.LoopCallback))
+    , PingPongCallback(MoveTemp(Other.PingPongCallback))
+    , Handle(Other.Handle)
+    , ThenBuilder(MoveTemp(Other.ThenBuilder))
+    , JoinBuilders(MoveTemp(Other.JoinBuilders))
+    , bHasSpec(Other.bHasSpec)
+    , bReserved(Other.bReserved)
+    , bLooping(Other.bLooping)
+    , bPingPong(Other.bPingPong)
+    , bActivated(Other.bActivated)
+    , bImmediate(Other.bImmediate)
+{
+    // The moved-from builder must not activate the reserved record a second time with an emptied spec.
+    Other.bHasSpec = false;
+    Other.bReserved = false;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::operator=(FNsTweenBuilder&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Activate();
 
-FNsTweenBuilder& FNsTweenBuilder::operator=(FNsTweenBuilder&& Other) noexcept = default;
+        Spec = MoveTemp(Other.Spec);
+        StrategyFactory = MoveTemp(Other.StrategyFactory);
+        CompleteCallback = MoveTemp(Other.CompleteCallback);
+        LoopCallback = MoveTemp(Other.LoopCallback);
+        PingPongCallback = MoveTemp(Other.PingPongCallback);
+        Handle = Other.Handle;
+        ThenBuilder = MoveTemp(Other.ThenBuilder);
+        JoinBuilders = MoveTemp(Other.JoinBuilders);
+        bHasSpec = Other.bHasSpec;
+        bReserved = Other.bReserved;
+        bLooping = Other.bLooping;
+        bPingPong = Other.bPingPong;
+        bActivated = Other.bActivated;
+        bImmediate = Other.bImmediate;
+
+        Other.bHasSpec = false;
+        Other.bReserved = false;
+    }
+
+    return *this;
+}
 
 FNsTweenBuilder::~FNsTweenBuilder()
 {
@@ -35,7 +94,22 @@ bool FNsTweenBuilder::CanConfigure() const
     return bHasSpec && !bActivated;
 }
 
+UNsTweenSubsystem* FNsTweenBuilder::GetRunningSubsystem() const
+{
+    if (!bActivated || !Handle.IsValid())
+    {
+        return nullptr;
+    }
+
+    return UNsTweenSubsystem::GetSubsystem();
+}
+
 void FNsTweenBuilder::Activate() const
+{
+    ActivateAfter(FNsTweenHandle());
+}
+
+void FNsTweenBuilder::ActivateAfter(const FNsTweenHandle& Predecessor) const
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::Activate");
 
@@ -44,28 +118,157 @@ void FNsTweenBuilder::Activate() const
         return;
     }
 
+    Spawn(Predecessor);
+
+    // Joined tweens wait for the same predecessor; the Then successor waits for this tween.
+    for (const TUniquePtr<FNsTweenBuilder>& Joined : JoinBuilders)
+    {
+        Joined->ActivateAfter(Predecessor);
+    }
+
+    // A tween that failed to spawn never completes, so its successor must never play rather than play now.
+    if (ThenBuilder)
+    {
+        if (Handle.IsValid())
+        {
+            ThenBuilder->ActivateAfter(Handle);
+        }
+        else
+        {
+            ThenBuilder->Disarm();
+        }
+    }
+}
+
+void FNsTweenBuilder::Disarm() const
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::Disarm");
+
+    if (!bHasSpec || bActivated)
+    {
+        return;
+    }
+
+    bActivated = true;
+    StrategyFactory = {};
+
+    // A reserved record goes back to the pool instead of waiting in the reserved list forever.
+    if (bReserved && Handle.IsValid())
+    {
+        if (UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem())
+        {
+            Subsystem->DiscardReserved(Handle);
+        }
+    }
+    Handle.Reset();
+
+    for (const TUniquePtr<FNsTweenBuilder>& Joined : JoinBuilders)
+    {
+        Joined->Disarm();
+    }
+
+    if (ThenBuilder)
+    {
+        ThenBuilder->Disarm();
+    }
+}
+
+void FNsTweenBuilder::Spawn(const FNsTweenHandle& Predecessor) const
+{
     UpdateWrapMode();
+    bActivated = true;
+
+    UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem();
+
+    // Typed spawns already built their strategy inside a reserved record; hand it the spec by move.
+    if (bReserved)
+    {
+        if (!Subsystem)
+        {
+            Handle.Reset();
+        }
+        else if (Predecessor.IsValid())
+        {
+            Handle = Subsystem->SpawnAfter(Predecessor, Handle, MoveTemp(Spec));
+        }
+        else if (bImmediate)
+        {
+            Handle = Subsystem->SpawnImmediate(Handle, MoveTemp(Spec));
+        }
+        else
+        {
+            Handle = Subsystem->EnqueueSpawn(Handle, MoveTemp(Spec));
+        }
+        return;
+    }
 
     if (!StrategyFactory)
     {
-        bActivated = true;
         return;
     }
 
     TSharedPtr<ITweenValue> Strategy = StrategyFactory();
     StrategyFactory = {};
-    if (!Strategy.IsValid())
+    if (!Strategy.IsValid() || !Subsystem)
     {
-        bActivated = true;
         return;
     }
 
-    if (UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem())
+    if (Predecessor.IsValid())
+    {
+        Handle = Subsystem->SpawnAfter(Predecessor, MoveTemp(Spec), MoveTemp(Strategy));
+    }
+    else if (bImmediate)
+    {
+        Handle = Subsystem->SpawnImmediate(MoveTemp(Spec), MoveTemp(Strategy));
+    }
+    else
     {
-        Handle = Subsystem->EnqueueSpawn(Spec, Strategy);
+        Handle = Subsystem->EnqueueSpawn(MoveTemp(Spec), MoveTemp(Strategy));
     }
+}
 
-    bActivated = true;
+FNsTweenBuilder& FNsTweenBuilder::GetChainTail()
+{
+    FNsTweenBuilder* Tail = this;
+    while (Tail->ThenBuilder)
+    {
+        Tail = Tail->ThenBuilder.Get();
+    }
+    return *Tail;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::Then(FNsTweenBuilder&& Next)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::Then");
+
+    if (CanConfigure())
+    {
+        GetChainTail().ThenBuilder = MakeUnique<FNsTweenBuilder>(MoveTemp(Next));
+    }
+    else
+    {
+        // Nothing will ever start it; without this the temporary's destructor would play it right away.
+        Next.Disarm();
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::Join(FNsTweenBuilder&& Other)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::Join");
+
+    if (CanConfigure())
+    {
+        GetChainTail().JoinBuilders.Add(MakeUnique<FNsTweenBuilder>(MoveTemp(Other)));
+    }
+    else
+    {
+        Other.Disarm();
+    }
+
+    return *this;
 }
 
 void FNsTweenBuilder::UpdateWrapMode() const
@@ -140,6 +343,58 @@ FNsTweenBuilder& FNsTweenBuilder::SetTimeScale(float TimeScale)
     {
         Spec.TimeScale = FMath::Max(TimeScale, KINDA_SMALL_NUMBER);
     }
+    else if (UNsTweenSubsystem* Subsystem = GetRunningSubsystem())
+    {
+        Subsystem->EnqueueSetTimeScale(Handle, FMath::Max(TimeScale, KINDA_SMALL_NUMBER));
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetDuration(float DurationSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetDuration");
+
+    if (CanConfigure())
+    {
+        Spec.DurationSeconds = DurationSeconds;
+    }
+    else if (UNsTweenSubsystem* Subsystem = GetRunningSubsystem())
+    {
+        Subsystem->EnqueueSetDuration(Handle, DurationSeconds);
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetEase(ENsTweenEase Ease)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetEase");
+
+    if (CanConfigure())
+    {
+        Spec.EasingPreset = Ease;
+    }
+    else if (UNsTweenSubsystem* Subsystem = GetRunningSubsystem())
+    {
+        FNsTweenSpec Easing;
+        Easing.EasingPreset = Ease;
+        Subsystem->EnqueueSetEasing(Handle, Easing);
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetEndValue(const FNsTweenValue& EndValue, bool bVelocityContinuous)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetEndValue");
+
+    Activate();
+
+    if (UNsTweenSubsystem* Subsystem = GetRunningSubsystem())
+    {
+        Subsystem->EnqueueSetEndValue(Handle, EndValue, bVelocityContinuous);
+    }
 
     return *this;
 }
@@ -156,6 +411,40 @@ FNsTweenBuilder& FNsTweenBuilder::SetCurveAsset(UCurveFloat* Curve)
             Spec.EasingPreset = ENsTweenEase::CurveAsset;
         }
     }
+    else if (UNsTweenSubsystem* Subsystem = GetRunningSubsystem())
+    {
+        if (Curve)
+        {
+            FNsTweenSpec Easing;
+            Easing.EasingPreset = ENsTweenEase::CurveAsset;
+            Easing.CurveAsset = Curve;
+            Subsystem->EnqueueSetEasing(Handle, Easing);
+        }
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetRotationMode(ENsTweenRotationMode Mode)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetRotationMode");
+
+    if (CanConfigure())
+    {
+        Spec.RotationMode = Mode;
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetColorMode(ENsTweenColorMode Mode)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetColorMode");
+
+    if (CanConfigure())
+    {
+        Spec.ColorMode = Mode;
+    }
 
     return *this;
 }
@@ -173,6 +462,44 @@ FNsTweenBuilder& FNsTweenBuilder::SetOwner(UObject* InOwner)
     return *this;
 }
 
+FNsTweenBuilder& FNsTweenBuilder::SetImmediate(bool bEnable)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetImmediate");
+
+    if (CanConfigure())
+    {
+        bImmediate = bEnable;
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetClock(const FNsTweenClockHandle& Clock)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetClock");
+
+    if (CanConfigure())
+    {
+        Spec.Clock = Clock;
+    }
+
+    return *this;
+}
+
+FNsTweenBuilder& FNsTweenBuilder::SetTarget(UObject* Object, FName Channel, ENsTweenOverwrite Overwrite)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::SetTarget");
+
+    if (CanConfigure())
+    {
+        Spec.Target.Object = FObjectKey(Object);
+        Spec.Target.Channel = Channel;
+        Spec.Overwrite = Overwrite;
+    }
+
+    return *this;
+}
+
 FNsTweenBuilder& FNsTweenBuilder::OnComplete(TFunction<void()> Callback)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBuilder::OnComplete");
@@ -1,13 +1,123 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "NsTweenFunctionLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
 #include "NsTweenSubsystem.h"
 #include "Utils/NsTweenProfiling.h"
 #include "ValueStrategies/TweenValue_Color.h"
+#include "ValueStrategies/TweenValue_ComponentTransform.h"
 #include "ValueStrategies/TweenValue_Float.h"
+#include "ValueStrategies/TweenValue_InstanceSpan.h"
+#include "ValueStrategies/TweenValue_MaterialParameter.h"
 #include "ValueStrategies/TweenValue_Rotator.h"
 #include "ValueStrategies/TweenValue_Transform.h"
 #include "ValueStrategies/TweenValue_Vector.h"
+#include "ValueStrategies/TweenValue_Widget.h"
+
+FNsTweenHandle PlayComponentTransformTween(USceneComponent* Component, ENsTweenTransformChannel Channels, const FTransform& StartValue, const FTransform& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::PlayComponentTransformTween");
+    UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem();
+    if (!Component || !Subsystem || Channels == ENsTweenTransformChannel::None)
+    {
+        return FNsTweenHandle();
+    }
+
+    FNsTweenTransformBatcher* Batcher = &Subsystem->GetTransformBatcher();
+    const FNsTweenBuilder Builder = FNsTween::Play(Spec, [Batcher, Component, Channels, StartValue, EndValue, Options]() -> TSharedPtr<ITweenValue>
+    {
+        return MakeShared<FTweenValue_ComponentTransform>(*Batcher, Component, Channels, StartValue, EndValue, Options);
+    });
+
+    return Builder.GetHandle();
+}
+
+FNsTweenHandle PlayWidgetTween(UWidget* Widget, ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& StartValue, const FNsTweenWidgetState& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::PlayWidgetTween");
+    UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem();
+    if (!Widget || !Subsystem || Channels == ENsTweenWidgetChannel::None)
+    {
+        return FNsTweenHandle();
+    }
+
+    FNsTweenWidgetBatcher* Batcher = &Subsystem->GetWidgetBatcher();
+    const FNsTweenBuilder Builder = FNsTween::Play(Spec, [Batcher, Widget, Channels, StartValue, EndValue]() -> TSharedPtr<ITweenValue>
+    {
+        return MakeShared<FTweenValue_Widget>(*Batcher, Widget, Channels, StartValue, EndValue);
+    });
+
+    return Builder.GetHandle();
+}
+
+FNsTweenHandle PlayInstanceTransformsTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, TConstArrayView<FTransform> StartValues, TConstArrayView<FTransform> EndValues, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::PlayInstanceTransformsTween");
+    UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem();
+    if (!Component || !Subsystem || FirstInstance < 0 || StartValues.Num() == 0 || StartValues.Num() != EndValues.Num())
+    {
+        return FNsTweenHandle();
+    }
+
+    FNsTweenInstanceBatcher* Batcher = &Subsystem->GetInstanceBatcher();
+    const FNsTweenBuilder Builder = FNsTween::Play(Spec, [Batcher, Component, FirstInstance, Start = TArray<FTransform>(StartValues), End = TArray<FTransform>(EndValues)]() -> TSharedPtr<ITweenValue>
+    {
+        return MakeShared<FTweenValue_InstanceSpan>(*Batcher, Component, FirstInstance, Start.Num(), Start, End, 0, 0, TConstArrayView<float>(), TConstArrayView<float>());
+    });
+
+    return Builder.GetHandle();
+}
+
+FNsTweenHandle PlayInstanceCustomDataTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, int32 CustomDataIndex, int32 NumCustomData, TConstArrayView<float> StartValues, TConstArrayView<float> EndValues, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::PlayInstanceCustomDataTween");
+    UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem();
+    if (!Component || !Subsystem || FirstInstance < 0 || CustomDataIndex < 0 || NumCustomData <= 0
+        || StartValues.Num() == 0 || StartValues.Num() % NumCustomData != 0 || StartValues.Num() != EndValues.Num())
+    {
+        return FNsTweenHandle();
+    }
+
+    FNsTweenInstanceBatcher* Batcher = &Subsystem->GetInstanceBatcher();
+    const FNsTweenBuilder Builder = FNsTween::Play(Spec, [Batcher, Component, FirstInstance, CustomDataIndex, NumCustomData, Start = TArray<float>(StartValues), End = TArray<float>(EndValues)]() -> TSharedPtr<ITweenValue>
+    {
+        return MakeShared<FTweenValue_InstanceSpan>(*Batcher, Component, FirstInstance, Start.Num() / NumCustomData, TConstArrayView<FTransform>(), TConstArrayView<FTransform>(), CustomDataIndex, NumCustomData, Start, End);
+    });
+
+    return Builder.GetHandle();
+}
+
+namespace NsTweenMaterial
+{
+    /** Routes a material parameter tween through the subsystem's material batcher. */
+    FNsTweenHandle Play(UObject* Instance, FName ParameterName, ENsTweenMaterialParameterType Type, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec)
+    {
+        UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem();
+        if (!Instance || !Subsystem || ParameterName.IsNone())
+        {
+            return FNsTweenHandle();
+        }
+
+        FNsTweenMaterialBatcher* Batcher = &Subsystem->GetMaterialBatcher();
+        const FNsTweenBuilder Builder = FNsTween::Play(Spec, [Batcher, Instance, ParameterName, Type, StartValue, EndValue]() -> TSharedPtr<ITweenValue>
+        {
+            return MakeShared<FTweenValue_MaterialParameter>(*Batcher, Instance, ParameterName, Type, StartValue, EndValue);
+        });
+
+        return Builder.GetHandle();
+    }
+
+    /** Returns the world's instance of a parameter collection. */
+    UMaterialParameterCollectionInstance* FindCollectionInstance(const UObject* WorldContextObject, UMaterialParameterCollection* Collection)
+    {
+        UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+        return World && Collection ? World->GetParameterCollectionInstance(Collection) : nullptr;
+    }
+}
 
 FNsTweenHandle UNsTweenBlueprintLibrary::PlayFloatTween(float StartValue, float EndValue, float& Target, const FNsTweenSpec& Spec)
 {
@@ -39,6 +149,142 @@ FNsTweenHandle UNsTweenBlueprintLibrary::PlayColorTween(const FLinearColor& Star
     return PlayTypedTween<FLinearColor, FTweenValue_Color>(Target, StartValue, EndValue, Spec);
 }
 
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayFloatPropertyTween(UObject* Target, const FString& PropertyPath, float StartValue, float EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayFloatPropertyTween");
+    return PlayPropertyTween<float>(Target, PropertyPath, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayVectorPropertyTween(UObject* Target, const FString& PropertyPath, const FVector& StartValue, const FVector& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayVectorPropertyTween");
+    return PlayPropertyTween<FVector>(Target, PropertyPath, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayRotatorPropertyTween(UObject* Target, const FString& PropertyPath, const FRotator& StartValue, const FRotator& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayRotatorPropertyTween");
+    return PlayPropertyTween<FRotator>(Target, PropertyPath, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayTransformPropertyTween(UObject* Target, const FString& PropertyPath, const FTransform& StartValue, const FTransform& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayTransformPropertyTween");
+    return PlayPropertyTween<FTransform>(Target, PropertyPath, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayColorPropertyTween(UObject* Target, const FString& PropertyPath, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayColorPropertyTween");
+    return PlayPropertyTween<FLinearColor>(Target, PropertyPath, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayComponentLocationTween(USceneComponent* Component, const FVector& StartValue, const FVector& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayComponentLocationTween");
+    return ::PlayComponentTransformTween(Component, ENsTweenTransformChannel::Location, FTransform(StartValue), FTransform(EndValue), Spec, Options);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayComponentRotationTween(USceneComponent* Component, const FRotator& StartValue, const FRotator& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayComponentRotationTween");
+    return ::PlayComponentTransformTween(Component, ENsTweenTransformChannel::Rotation, FTransform(StartValue), FTransform(EndValue), Spec, Options);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayComponentScaleTween(USceneComponent* Component, const FVector& StartValue, const FVector& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayComponentScaleTween");
+    return ::PlayComponentTransformTween(Component, ENsTweenTransformChannel::Scale, FTransform(FQuat::Identity, FVector::ZeroVector, StartValue), FTransform(FQuat::Identity, FVector::ZeroVector, EndValue), Spec, Options);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayComponentTransformTween(USceneComponent* Component, const FTransform& StartValue, const FTransform& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayComponentTransformTween");
+    return ::PlayComponentTransformTween(Component, ENsTweenTransformChannel::All, StartValue, EndValue, Spec, Options);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayMaterialScalarTween(UMaterialInstanceDynamic* Material, FName ParameterName, float StartValue, float EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayMaterialScalarTween");
+    return NsTweenMaterial::Play(Material, ParameterName, ENsTweenMaterialParameterType::Scalar, FLinearColor(StartValue, 0.f, 0.f, 0.f), FLinearColor(EndValue, 0.f, 0.f, 0.f), Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayMaterialVectorTween(UMaterialInstanceDynamic* Material, FName ParameterName, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayMaterialVectorTween");
+    return NsTweenMaterial::Play(Material, ParameterName, ENsTweenMaterialParameterType::Vector, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayParameterCollectionScalarTween(UObject* WorldContextObject, UMaterialParameterCollection* Collection, FName ParameterName, float StartValue, float EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayParameterCollectionScalarTween");
+    return NsTweenMaterial::Play(NsTweenMaterial::FindCollectionInstance(WorldContextObject, Collection), ParameterName, ENsTweenMaterialParameterType::Scalar,
+        FLinearColor(StartValue, 0.f, 0.f, 0.f), FLinearColor(EndValue, 0.f, 0.f, 0.f), Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayParameterCollectionVectorTween(UObject* WorldContextObject, UMaterialParameterCollection* Collection, FName ParameterName, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayParameterCollectionVectorTween");
+    return NsTweenMaterial::Play(NsTweenMaterial::FindCollectionInstance(WorldContextObject, Collection), ParameterName, ENsTweenMaterialParameterType::Vector, StartValue, EndValue, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayWidgetTranslationTween(UWidget* Widget, FVector2D StartValue, FVector2D EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayWidgetTranslationTween");
+    FNsTweenWidgetState Start, End;
+    Start.Translation = StartValue;
+    End.Translation = EndValue;
+    return ::PlayWidgetTween(Widget, ENsTweenWidgetChannel::Translation, Start, End, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayWidgetScaleTween(UWidget* Widget, FVector2D StartValue, FVector2D EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayWidgetScaleTween");
+    FNsTweenWidgetState Start, End;
+    Start.Scale = StartValue;
+    End.Scale = EndValue;
+    return ::PlayWidgetTween(Widget, ENsTweenWidgetChannel::Scale, Start, End, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayWidgetAngleTween(UWidget* Widget, float StartValue, float EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayWidgetAngleTween");
+    FNsTweenWidgetState Start, End;
+    Start.Angle = StartValue;
+    End.Angle = EndValue;
+    return ::PlayWidgetTween(Widget, ENsTweenWidgetChannel::Angle, Start, End, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayWidgetOpacityTween(UWidget* Widget, float StartValue, float EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayWidgetOpacityTween");
+    FNsTweenWidgetState Start, End;
+    Start.Opacity = StartValue;
+    End.Opacity = EndValue;
+    return ::PlayWidgetTween(Widget, ENsTweenWidgetChannel::Opacity, Start, End, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayWidgetColorTween(UWidget* Widget, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayWidgetColorTween");
+    FNsTweenWidgetState Start, End;
+    Start.Color = StartValue;
+    End.Color = EndValue;
+    return ::PlayWidgetTween(Widget, ENsTweenWidgetChannel::Color, Start, End, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayInstanceTransformsTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, const TArray<FTransform>& StartValues, const TArray<FTransform>& EndValues, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayInstanceTransformsTween");
+    return ::PlayInstanceTransformsTween(Component, FirstInstance, StartValues, EndValues, Spec);
+}
+
+FNsTweenHandle UNsTweenBlueprintLibrary::PlayInstanceCustomDataTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, int32 CustomDataIndex, const TArray<float>& StartValues, const TArray<float>& EndValues, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PlayInstanceCustomDataTween");
+    return ::PlayInstanceCustomDataTween(Component, FirstInstance, CustomDataIndex, 1, StartValues, EndValues, Spec);
+}
+
 void UNsTweenBlueprintLibrary::PauseTween(FNsTweenHandle Handle)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenBlueprintLibrary::PauseTween");
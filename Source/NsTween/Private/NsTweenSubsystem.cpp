@@ -2,12 +2,11 @@
 
 #include "NsTweenSubsystem.h"
 #include "Containers/Ticker.h"
-#include "Easing/NsTweenBezierEasing.h"
-#include "Easing/NsTweenCurveAssetEasingAdapter.h"
-#include "Easing/NsTweenPolynomialEasing.h"
+#include "Easing/NsTweenEasingFactory.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/IEasingCurve.h"
 #include "Interfaces/ITweenValue.h"
 #include "Misc/CoreDelegates.h"
@@ -19,6 +18,21 @@
 #include "Editor.h"
 #endif
 
+static FAutoConsoleCommand GNsTweenMemReportCommand(
+    TEXT("NsTween.MemReport"),
+    TEXT("Logs the memory held by live, pending and pooled tween records."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        if (const UNsTweenSubsystem* Subsystem = UNsTweenSubsystem::GetSubsystem())
+        {
+            Subsystem->LogMemoryStats();
+        }
+        else
+        {
+            UE_LOG(LogNsTween, Display, TEXT("NsTween.MemReport: no tween subsystem is running."));
+        }
+    }));
+
 UNsTweenSubsystem::UNsTweenSubsystem()
 {
 
@@ -30,9 +44,23 @@ void UNsTweenSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     Super::Initialize(Collection);
     NextTweenId.Set(0);
 
-    // Core ticker
-    FTickerDelegate Delegate = FTickerDelegate::CreateUObject(this, &UNsTweenSubsystem::Tick);
-    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(Delegate);
+    // Warm the record pool so spawns reuse memory instead of allocating it.
+    const int32 RecordCount = FMath::Max(PreallocatedTweens, 0);
+    TweenPool.Reserve(RecordCount);
+    ColdTable.Reserve(RecordCount);
+    FreeTweens.Reserve(RecordCount);
+    ReservedTweens.Reserve(RecordCount);
+    PendingTweens.Reserve(RecordCount);
+    for (int32 RecordIndex = 0; RecordIndex < RecordCount; ++RecordIndex)
+    {
+        FreeTweens.Add(AllocateRecord());
+    }
+
+    // Core ticker: registered by the first spawn rather than here, so a game without tweens never ticks.
+    {
+        FScopeLock Lock(&TickerLock);
+        bTickerEnabled = true;
+    }
 
     // Runtime teardown
     FWorldDelegates::OnWorldBeginTearDown.AddUObject(this, &UNsTweenSubsystem::HandleWorldBeginTearDown);
@@ -48,11 +76,16 @@ void UNsTweenSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void UNsTweenSubsystem::Deinitialize()
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::Deinitialize");
-    // Kill ticker first so no more ticks arrive
-    if (TickerHandle.IsValid())
+    // Kill ticker first so no more ticks arrive, and keep late wakes from registering it again
     {
-        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
-        TickerHandle.Reset();
+        FScopeLock Lock(&TickerLock);
+        bTickerEnabled = false;
+        bTickerAwake = false;
+        if (TickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+            TickerHandle.Reset();
+        }
     }
 
     // Unhook delegates
@@ -71,6 +104,26 @@ void UNsTweenSubsystem::Deinitialize()
     StopAllTweens(/*bApplyFinalOnCancel*/ false);
     DrainCommandQueue();
 
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        TweenPool.Empty();
+        PendingTweens.Empty();
+        Successors.Empty();
+        RecordsByHandle.Empty();
+        Targets.Empty();
+        ReservedTweens.Empty();
+        FreeTweens.Empty();
+        ColdTable.Empty();
+    }
+    Clocks.Empty();
+    FreeClocks.Empty();
+    CompactPool.Empty();
+    SpringPool.Empty();
+    TransformBatcher.Empty();
+    MaterialBatcher.Empty();
+    WidgetBatcher.Empty();
+    InstanceBatcher.Empty();
+
     Super::Deinitialize();
 }
 
@@ -111,9 +164,70 @@ bool UNsTweenSubsystem::ShouldTick() const
     return true;
 }
 
+void UNsTweenSubsystem::WakeTicker()
+{
+    if (bTickerAwake)
+    {
+        return;
+    }
+
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::WakeTicker");
+    FScopeLock Lock(&TickerLock);
+    if (bTickerEnabled && !bTickerAwake)
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UNsTweenSubsystem::Tick));
+        bTickerAwake = true;
+    }
+}
+
+bool UNsTweenSubsystem::SleepTicker()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SleepTicker");
+    FScopeLock Lock(&TickerLock);
+    bTickerAwake = false;
+
+    // A producer that saw the ticker awake just before the store queued its work first; keep ticking for it.
+    if (!IsIdle())
+    {
+        bTickerAwake = true;
+        return true;
+    }
+
+    // Returning false removes the ticker; the handle goes with it.
+    TickerHandle.Reset();
+    return false;
+}
+
+bool UNsTweenSubsystem::IsIdle() const
+{
+    // Settled springs sleep on their own. Running clocks keep the ticker so their time runs on while no tween uses
+    // them; paused and finished ones do not, and wake it again when resumed or sought.
+    if (TweenPool.Num() > 0 || !CommandQueue.IsEmpty() || CompactPool.Num() > 0 || SpringPool.NumAwake() > 0)
+    {
+        return false;
+    }
+
+    for (const FClockSlot& Slot : Clocks)
+    {
+        if (Slot.bInUse && Slot.Clock.IsRunning())
+        {
+            return false;
+        }
+    }
+
+    FReadScopeLock ReadLock(PoolLock);
+    return PendingTweens.Num() == 0;
+}
+
 bool UNsTweenSubsystem::Tick(float DeltaTime)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::Tick");
+    // Nothing left to run: drop off the core ticker until the next spawn or command wakes it.
+    if (IsIdle())
+    {
+        return SleepTicker();
+    }
+
     // Don’t process anything during teardown/after PIE
     if (!ShouldTick())
     {
@@ -125,66 +239,96 @@ bool UNsTweenSubsystem::Tick(float DeltaTime)
 
     if (DeltaTime < KINDA_SMALL_NUMBER)
     {
+        // Cancels applying their final value still need their batched writes applied.
+        FlushBatchers();
         return true;
     }
 
-    TArray<FNsTween*, TInlineAllocator<32>> Candidates;
+    // Shared clocks run their timing once for every tween attached to them.
+    AdvanceClocks(DeltaTime);
+
+    // Phase 1: Tick the packed hot records in place. Only the game thread restructures TweenPool (command pump,
+    // chained successors, compaction, teardown), and new spawns land in PendingTweens, so the array is stable while
+    // callbacks run.
+    // Successors started by completing tweens are appended behind NumLive and ticked with their leftover time only.
     bool bRequiresCompaction = false;
+    bTickingTweens = true;
+    const int32 NumLive = TweenPool.Num();
+    for (int32 Index = 0; Index < NumLive; ++Index)
     {
-        // Phase 1: Take a read lock and gather the tweens that are still active.
-        FReadScopeLock ReadLock(PoolLock);
-        Candidates.Reserve(TweenPool.Num());
+        FNsTween& Instance = TweenPool[Index];
+        if (!Instance.IsActive())
+        {
+            bRequiresCompaction = true;
+            continue;
+        }
 
-        for (int32 Index = 0; Index < TweenPool.Num(); ++Index)
+        // Clock-driven tweens only ease and apply; a released clock stops its tweens where they are.
+        bool bRunning = true;
+        float LeftoverSeconds = -1.f;
+        if (Instance.GetClock().IsValid())
         {
-            const TUniquePtr<FNsTween>& Instance = TweenPool[Index];
-            if (!Instance)
+            if (const FNsTweenClock* Clock = FindClock(Instance.GetClock()))
             {
-                bRequiresCompaction = true;
-                continue;
+                bRunning = Instance.TickOnClock(Clock->GetFrame(), LeftoverSeconds);
             }
-
-            if (!Instance->IsActive())
+            else
             {
-                bRequiresCompaction = true;
-                continue;
+                Instance.Cancel(/*bApplyFinal*/ false);
+                bRunning = false;
             }
-
-            Candidates.Add(Instance.Get());
         }
-    }
-
-    // Phase 2: Tick outside the lock so Update/OnComplete callbacks can execute without blocking
-    // other readers/writers attempting to enqueue commands.
-    for (FNsTween* Candidate : Candidates)
-    {
-        if (!Candidate)
+        else
         {
-            continue;
+            bRunning = Instance.Tick(DeltaTime, LeftoverSeconds);
         }
 
         // If tick returns false, it’s finished or invalid — mark the pool for compaction.
-        if (!Candidate->Tick(DeltaTime))
+        if (!bRunning)
         {
             bRequiresCompaction = true;
+
+            // Only a completion starts the chain; tweens that were stopped take their successors with them.
+            const FNsTweenHandle FinishedHandle = Instance.GetHandle();
+            if (LeftoverSeconds >= 0.f)
+            {
+                StartSuccessors(FinishedHandle, LeftoverSeconds);
+            }
+            else
+            {
+                DropSuccessors(FinishedHandle);
+            }
         }
     }
+    bTickingTweens = false;
 
-    // Phase 3: Acquire a write lock only long enough to prune tweens that finished or became invalid.
+    // Phase 2: Acquire a write lock only long enough to prune tweens that finished or became invalid.
     if (bRequiresCompaction)
     {
-        FWriteScopeLock WriteLock(PoolLock);
-        for (int32 Index = TweenPool.Num() - 1; Index >= 0; --Index)
+        TArray<FNsTweenColdData*, TInlineAllocator<32>> Finished;
         {
-            const TUniquePtr<FNsTween>& Instance = TweenPool[Index];
-            if (!Instance || !Instance->IsActive())
+            FWriteScopeLock WriteLock(PoolLock);
+            for (int32 Index = TweenPool.Num() - 1; Index >= 0; --Index)
             {
-                TweenPool.RemoveAtSwap(Index);
+                if (!TweenPool[Index].IsActive())
+                {
+                    Finished.Add(TweenPool[Index].GetColdData());
+                    RemoveLiveAtSwap(Index);
+                }
             }
         }
+
+        // Finished cold records go back to the free list rather than being destroyed.
+        ReleaseRecords(Finished);
     }
 
-    Candidates.Reset();
+    // Springs write through their callbacks, so their writes go out with the batched ones below.
+    SpringPool.Tick(DeltaTime);
+
+    // Phase 3: Apply the batched component, material and widget writes of this tick, once per target.
+    FlushBatchers();
+
+    CompactPool.Tick(DeltaTime);
 
     return true;
 }
@@ -192,31 +336,259 @@ bool UNsTweenSubsystem::Tick(float DeltaTime)
 void UNsTweenSubsystem::StopAllTweens(bool bApplyFinalOnCancel)
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::StopAllTweens");
-    TArray<TUniquePtr<FNsTween>> TweensToCancel;
+    TArray<FNsTween> TweensToCancel;
+    TArray<FNsTweenColdData*> RecordsToRelease;
     {
         FWriteScopeLock WriteLock(PoolLock);
-        TweensToCancel.Reserve(TweenPool.Num());
 
-        for (int32 Index = TweenPool.Num() - 1; Index >= 0; --Index)
+        // Started-but-unpumped spawns are dropped like queued spawn commands; they never ran, so no completion fires.
+        RecordsToRelease.Reserve(TweenPool.Num() + PendingTweens.Num());
+        for (const FNsTween& Pending : PendingTweens)
+        {
+            RecordsToRelease.Add(Pending.GetColdData());
+        }
+        PendingTweens.Reset();
+
+        // Successors waiting on a chain are dropped the same way.
+        for (const TPair<FNsTweenId, TArray<FNsTween, TInlineAllocator<1>>>& Link : Successors)
+        {
+            for (const FNsTween& Linked : Link.Value)
+            {
+                RecordsToRelease.Add(Linked.GetColdData());
+            }
+        }
+        Successors.Reset();
+
+        // Called from a tween callback mid-tick: cancel in place and let the tick's compaction recycle the records.
+        if (!bTickingTweens)
         {
-            if (TUniquePtr<FNsTween>& Instance = TweenPool[Index])
+            TweensToCancel = TweenPool;
+            for (const FNsTween& Instance : TweenPool)
             {
-                TweensToCancel.Emplace(MoveTemp(Instance));
+                Instance.GetColdData()->LiveIndex = INDEX_NONE;
             }
+            TweenPool.Reset();
+        }
+    }
+
+    if (bTickingTweens)
+    {
+        for (int32 Index = 0; Index < TweenPool.Num(); ++Index)
+        {
+            TweenPool[Index].Cancel(bApplyFinalOnCancel);
+        }
+    }
+
+    for (FNsTween& Instance : TweensToCancel)
+    {
+        Instance.Cancel(bApplyFinalOnCancel);
+        RecordsToRelease.Add(Instance.GetColdData());
+    }
+
+    ReleaseRecords(RecordsToRelease);
+
+    // Final values written by the cancels go out now; mid-tick, the tick flushes once the callbacks return.
+    if (bApplyFinalOnCancel && !bTickingTweens)
+    {
+        FlushBatchers();
+    }
+
+    // Compact tweens and springs have no final-value or completion semantics on stop; they simply end where they are.
+    CompactPool.Reset();
+    SpringPool.Reset();
+}
+
+FNsTweenClockHandle UNsTweenSubsystem::CreateClock(const FNsTweenSpec& Timing)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::CreateClock");
+    int32 SlotIndex = INDEX_NONE;
+    if (FreeClocks.Num() > 0)
+    {
+        SlotIndex = FreeClocks.Pop(EAllowShrinking::No);
+    }
+    else if (Clocks.Num() < MAX_int16)
+    {
+        SlotIndex = Clocks.AddDefaulted();
+    }
+    else
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Cannot create tween clock: %d clocks are already live."), Clocks.Num());
+        return FNsTweenClockHandle();
+    }
+
+    FClockSlot& Slot = Clocks[SlotIndex];
+    Slot.Clock.Start(Timing);
+    Slot.bInUse = true;
+    WakeTicker();
+
+    FNsTweenClockHandle Handle;
+    Handle.Index = static_cast<int16>(SlotIndex);
+    Handle.Serial = Slot.Serial;
+    return Handle;
+}
+
+void UNsTweenSubsystem::ReleaseClock(const FNsTweenClockHandle& Clock)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ReleaseClock");
+    if (!FindClock(Clock))
+    {
+        return;
+    }
+
+    // Attached tweens notice the serial change on their next tick and stop.
+    FClockSlot& Slot = Clocks[Clock.Index];
+    Slot.bInUse = false;
+    ++Slot.Serial;
+    FreeClocks.Add(Clock.Index);
+}
+
+void UNsTweenSubsystem::SetClockPaused(const FNsTweenClockHandle& Clock, bool bPaused)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SetClockPaused");
+    if (FindClock(Clock))
+    {
+        Clocks[Clock.Index].Clock.SetPaused(bPaused);
+        if (!bPaused)
+        {
+            WakeTicker();
         }
+    }
+}
+
+void UNsTweenSubsystem::SeekClock(const FNsTweenClockHandle& Clock, float CycleSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SeekClock");
+    if (FindClock(Clock))
+    {
+        Clocks[Clock.Index].Clock.Seek(CycleSeconds);
+        WakeTicker();
+    }
+}
 
-        TweenPool.Reset();
+const FNsTweenClock* UNsTweenSubsystem::FindClock(const FNsTweenClockHandle& Clock) const
+{
+    if (!Clocks.IsValidIndex(Clock.Index))
+    {
+        return nullptr;
     }
 
-    for (TUniquePtr<FNsTween>& Instance : TweensToCancel)
+    const FClockSlot& Slot = Clocks[Clock.Index];
+    return (Slot.bInUse && Slot.Serial == Clock.Serial) ? &Slot.Clock : nullptr;
+}
+
+void UNsTweenSubsystem::ReleaseSpring(const FNsTweenSpringHandle& Spring)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ReleaseSpring");
+    SpringPool.Release(Spring);
+}
+
+void UNsTweenSubsystem::AdvanceClocks(float DeltaTime)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::AdvanceClocks");
+    for (FClockSlot& Slot : Clocks)
     {
-        if (Instance)
+        if (Slot.bInUse)
         {
-            Instance->Cancel(bApplyFinalOnCancel);
+            Slot.Clock.Advance(DeltaTime);
         }
     }
 }
 
+void UNsTweenSubsystem::FlushBatchers()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::FlushBatchers");
+    TransformBatcher.Flush();
+    MaterialBatcher.Flush();
+    WidgetBatcher.Flush();
+    InstanceBatcher.Flush();
+}
+
+int32 UNsTweenSubsystem::RegisterCompactTargets(TArrayView<float> Values, FNsTweenCompactComplete OnComplete)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::RegisterCompactTargets");
+    return CompactPool.RegisterTargets(Values, MoveTemp(OnComplete));
+}
+
+void UNsTweenSubsystem::UnregisterCompactTargets(int32 BlockId)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::UnregisterCompactTargets");
+    CompactPool.UnregisterTargets(BlockId);
+}
+
+bool UNsTweenSubsystem::SpawnCompactTween(int32 BlockId, int32 TargetIndex, float StartValue, float EndValue, float DurationSeconds, ENsTweenEase Ease, ENsTweenCompactFlags Flags)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnCompactTween");
+    const bool bSpawned = CompactPool.Spawn(BlockId, TargetIndex, StartValue, EndValue, DurationSeconds, Ease, Flags);
+    if (bSpawned)
+    {
+        WakeTicker();
+    }
+    return bSpawned;
+}
+
+FNsTweenMemoryStats UNsTweenSubsystem::GetMemoryStats() const
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::GetMemoryStats");
+    FReadScopeLock ReadLock(PoolLock);
+
+    FNsTweenMemoryStats Stats;
+    Stats.LiveTweens = TweenPool.Num();
+    Stats.PendingTweens = PendingTweens.Num();
+    Stats.ReservedTweens = ReservedTweens.Num();
+    for (const TPair<FNsTweenId, TArray<FNsTween, TInlineAllocator<1>>>& Link : Successors)
+    {
+        Stats.LinkedTweens += Link.Value.Num();
+    }
+    Stats.FreeRecords = FreeTweens.Num();
+    Stats.ColdRecords = ColdTable.Num();
+    Stats.HotRecordBytes = sizeof(FNsTween);
+    Stats.ColdRecordBytes = sizeof(FNsTweenColdData);
+    Stats.RecycledRecords = RecycledRecords;
+    Stats.AllocatedRecords = AllocatedRecords;
+    Stats.DiscardedRecords = DiscardedRecords;
+    const int64 Spawns = RecycledRecords + AllocatedRecords;
+    Stats.RecycleHitRate = Spawns > 0 ? static_cast<float>(static_cast<double>(RecycledRecords) / Spawns) : 0.f;
+    for (const TUniquePtr<FNsTweenColdData>& Record : ColdTable)
+    {
+        Stats.StrategyHeapBytes += Record->Strategy.GetHeapBlockSize();
+    }
+    Stats.HotAllocatedBytes = TweenPool.GetAllocatedSize() + PendingTweens.GetAllocatedSize() + Successors.GetAllocatedSize();
+    Stats.ColdAllocatedBytes = ColdTable.Num() * sizeof(FNsTweenColdData)
+        + ColdTable.GetAllocatedSize()
+        + FreeTweens.GetAllocatedSize()
+        + ReservedTweens.GetAllocatedSize()
+        + RecordsByHandle.GetAllocatedSize();
+    Stats.CompactTweens = CompactPool.Num();
+    Stats.CompactRecordBytes = sizeof(FNsTweenCompactRecord);
+    Stats.CompactAllocatedBytes = CompactPool.GetAllocatedSize();
+    Stats.Springs = SpringPool.Num();
+    Stats.AwakeSprings = SpringPool.NumAwake();
+    Stats.SpringAllocatedBytes = SpringPool.GetAllocatedSize();
+    return Stats;
+}
+
+void UNsTweenSubsystem::LogMemoryStats() const
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::LogMemoryStats");
+    const FNsTweenMemoryStats Stats = GetMemoryStats();
+    const int32 BytesPerTween = Stats.HotRecordBytes + Stats.ColdRecordBytes;
+
+    UE_LOG(LogNsTween, Display, TEXT("NsTween memory: %d live, %d pending, %d linked, %d reserved, %d free of %d records."),
+        Stats.LiveTweens, Stats.PendingTweens, Stats.LinkedTweens, Stats.ReservedTweens, Stats.FreeRecords, Stats.ColdRecords);
+    UE_LOG(LogNsTween, Display, TEXT("NsTween memory: hot %d B/tween (%llu B allocated), cold %d B/tween (%llu B allocated)."),
+        Stats.HotRecordBytes, static_cast<uint64>(Stats.HotAllocatedBytes), Stats.ColdRecordBytes, static_cast<uint64>(Stats.ColdAllocatedBytes));
+    UE_LOG(LogNsTween, Display, TEXT("NsTween memory: 100k tweens need %.1f MB hot, %.1f MB total (excluding heap-spilled strategies)."),
+        Stats.HotRecordBytes * 100000.0 / (1024.0 * 1024.0), BytesPerTween * 100000.0 / (1024.0 * 1024.0));
+    UE_LOG(LogNsTween, Display, TEXT("NsTween memory: %.1f%% of spawns recycled a record (%lld recycled, %lld allocated, %lld discarded), %llu B kept for spilled strategies."),
+        Stats.RecycleHitRate * 100.f, Stats.RecycledRecords, Stats.AllocatedRecords, Stats.DiscardedRecords, static_cast<uint64>(Stats.StrategyHeapBytes));
+
+    const double CompactBytesPerTween = Stats.CompactTweens > 0 ? static_cast<double>(Stats.CompactAllocatedBytes) / Stats.CompactTweens : 0.0;
+    UE_LOG(LogNsTween, Display, TEXT("NsTween memory: compact %d tweens, %d B/record, %.1f B/tween measured (%llu B allocated)."),
+        Stats.CompactTweens, Stats.CompactRecordBytes, CompactBytesPerTween, static_cast<uint64>(Stats.CompactAllocatedBytes));
+    UE_LOG(LogNsTween, Display, TEXT("NsTween memory: %d springs, %d awake (%llu B allocated)."),
+        Stats.Springs, Stats.AwakeSprings, static_cast<uint64>(Stats.SpringAllocatedBytes));
+}
+
 UNsTweenSubsystem* UNsTweenSubsystem::GetSubsystem()
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::GetSubsystem");
@@ -281,168 +653,912 @@ void UNsTweenSubsystem::HandlePrePIEEnded(const bool /*bIsSimulating*/)
 }
 #endif
 
-FNsTweenHandle UNsTweenSubsystem::EnqueueSpawn(const FNsTweenSpec& Spec, const TSharedPtr<ITweenValue>& Strategy)
+FNsTweenHandle UNsTweenSubsystem::AllocateHandle()
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSpawn");
-    FNsTweenCommand Command;
-    Command.Type = ENsTweenCommandType::Spawn;
-    Command.Spec = Spec;
-    Command.Strategy = Strategy;
-
     FNsTweenHandle Handle;
     Handle.Id.Value = static_cast<uint32>(NextTweenId.Increment());
-    Command.Handle = Handle;
-
-    CommandQueue.Enqueue(Command);
     return Handle;
 }
 
-void UNsTweenSubsystem::EnqueueCancel(const FNsTweenHandle& Handle, bool bApplyFinal)
+FNsTweenHandle UNsTweenSubsystem::EnqueueSpawn(const FNsTweenSpec& Spec, const TSharedPtr<ITweenValue>& Strategy)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueCancel");
-    if (!Handle.IsValid()) return;
-
-    FNsTweenCommand Command;
-    Command.Type = ENsTweenCommandType::Cancel;
-    Command.Handle = Handle;
-    Command.bApplyFinalOnCancel = bApplyFinal;
-    CommandQueue.Enqueue(Command);
+    return EnqueueSpawn(FNsTweenSpec(Spec), TSharedPtr<ITweenValue>(Strategy));
 }
 
-void UNsTweenSubsystem::EnqueuePause(const FNsTweenHandle& Handle)
+FNsTweenHandle UNsTweenSubsystem::EnqueueSpawn(FNsTweenSpec&& Spec, TSharedPtr<ITweenValue> Strategy)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueuePause");
-    if (!Handle.IsValid()) return;
-
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSpawn");
     FNsTweenCommand Command;
-    Command.Type = ENsTweenCommandType::Pause;
+    Command.Type = ENsTweenCommandType::Spawn;
+    Command.Spec = MoveTemp(Spec);
+    Command.Strategy = MoveTemp(Strategy);
+
+    const FNsTweenHandle Handle = AllocateHandle();
     Command.Handle = Handle;
-    CommandQueue.Enqueue(Command);
+
+    CommandQueue.Enqueue(MoveTemp(Command));
+    WakeTicker();
+    return Handle;
 }
 
-void UNsTweenSubsystem::EnqueueResume(const FNsTweenHandle& Handle)
+FNsTweenColdData* UNsTweenSubsystem::ReserveTween()
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueResume");
-    if (!Handle.IsValid()) return;
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ReserveTween");
+    const FNsTweenHandle Handle = AllocateHandle();
 
-    FNsTweenCommand Command;
-    Command.Type = ENsTweenCommandType::Resume;
-    Command.Handle = Handle;
-    CommandQueue.Enqueue(Command);
+    FWriteScopeLock WriteLock(PoolLock);
+    FNsTweenColdData* const Record = AcquireRecord(Handle);
+    ReservedTweens.Add(Record);
+    return Record;
 }
 
-bool UNsTweenSubsystem::IsActive(const FNsTweenHandle& Handle) const
+FNsTweenHandle UNsTweenSubsystem::EnqueueSpawn(const FNsTweenHandle& ReservedHandle, FNsTweenSpec&& Spec)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::IsActive");
-    FReadScopeLock ReadLock(PoolLock);
-    for (const TUniquePtr<FNsTween>& Instance : TweenPool)
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSpawnReserved");
+    if (!ReservedHandle.IsValid())
     {
-        if (Instance && Instance->IsActive() && Instance->GetHandle().Id.Value == Handle.Id.Value)
-        {
-            return true;
-        }
+        return FNsTweenHandle();
     }
-    return false;
-}
 
-void UNsTweenSubsystem::ProcessCommands()
-{
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ProcessCommands");
-    FNsTweenCommand Command;
-    while (CommandQueue.Dequeue(Command))
+    FNsTweenColdData* Record = nullptr;
     {
-        switch (Command.Type)
-        {
-            case ENsTweenCommandType::Spawn:  SpawnTween(Command);  break;
-            case ENsTweenCommandType::Cancel: CancelTween(Command);  break;
-            case ENsTweenCommandType::Pause:  PauseTween(Command);   break;
-            case ENsTweenCommandType::Resume: ResumeTween(Command);  break;
-            default: break;
-        }
+        FWriteScopeLock WriteLock(PoolLock);
+        Record = TakeReservedRecord(ReservedHandle);
     }
-}
 
-void UNsTweenSubsystem::SpawnTween(FNsTweenCommand& Command)
-{
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnTween");
-    if (!Command.Strategy.IsValid())
+    if (!Record)
     {
-        UE_LOG(LogNsTween, Warning, TEXT("Cannot spawn tween without strategy."));
-        return;
+        return FNsTweenHandle();
     }
 
-    TSharedPtr<IEasingCurve> Easing = CreateEasing(Command.Spec);
+    TSharedPtr<IEasingCurve> Easing = CreateEasing(Spec);
     if (!Easing.IsValid())
     {
         UE_LOG(LogNsTween, Warning, TEXT("Failed to create easing curve."));
-        return;
+        ReleaseRecords(MakeArrayView(&Record, 1));
+        return FNsTweenHandle();
     }
 
-    TUniquePtr<FNsTween> Instance = MakeUnique<FNsTween>(Command.Handle, MoveTemp(Command.Spec), Command.Strategy, Easing);
+    // The record is unreachable from the tick loop until it is published, so it can be started without the lock.
+    FNsTween Instance;
+    Instance.Start(*Record, MoveTemp(Spec), MoveTemp(Easing));
 
-    FWriteScopeLock WriteLock(PoolLock);
-    TweenPool.Add(MoveTemp(Instance));
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        PendingTweens.Add(Instance);
+    }
+
+    WakeTicker();
+    return ReservedHandle;
 }
 
-void UNsTweenSubsystem::CancelTween(const FNsTweenCommand& Command)
+void UNsTweenSubsystem::DiscardReserved(const FNsTweenHandle& ReservedHandle)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::CancelTween");
-    TUniquePtr<FNsTween> InstanceToCancel;
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::DiscardReserved");
+    FNsTweenColdData* Record = nullptr;
     {
         FWriteScopeLock WriteLock(PoolLock);
-        for (int32 Index = 0; Index < TweenPool.Num(); ++Index)
-        {
-            TUniquePtr<FNsTween>& Instance = TweenPool[Index];
-            if (Instance && Instance->GetHandle().Id.Value == Command.Handle.Id.Value)
-            {
-                InstanceToCancel = MoveTemp(Instance);
-                TweenPool.RemoveAtSwap(Index);
-                break;
-            }
-        }
+        Record = TakeReservedRecord(ReservedHandle);
     }
 
-    if (InstanceToCancel)
+    if (Record)
     {
-        InstanceToCancel->Cancel(Command.bApplyFinalOnCancel);
+        ReleaseRecords(MakeArrayView(&Record, 1));
     }
 }
 
-void UNsTweenSubsystem::PauseTween(const FNsTweenCommand& Command)
+FNsTweenColdData* UNsTweenSubsystem::TakeReservedRecord(const FNsTweenHandle& ReservedHandle)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::PauseTween");
-    FWriteScopeLock WriteLock(PoolLock);
-    for (const TUniquePtr<FNsTween>& Instance : TweenPool)
+    // Builders usually activate in reservation order, so the record is almost always at the back.
+    for (int32 Index = ReservedTweens.Num() - 1; Index >= 0; --Index)
     {
-        if (Instance && Instance->GetHandle().Id.Value == Command.Handle.Id.Value)
+        if (ReservedTweens[Index]->GetHandle().Id.Value == ReservedHandle.Id.Value)
         {
-            Instance->SetPaused(true);
-            break;
+            FNsTweenColdData* const Record = ReservedTweens[Index];
+            ReservedTweens.RemoveAtSwap(Index, EAllowShrinking::No);
+            return Record;
         }
     }
+
+    return nullptr;
 }
 
-void UNsTweenSubsystem::ResumeTween(const FNsTweenCommand& Command)
+FNsTweenHandle UNsTweenSubsystem::SpawnImmediate(const FNsTweenHandle& ReservedHandle, FNsTweenSpec&& Spec)
 {
-    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ResumeTween");
-    FWriteScopeLock WriteLock(PoolLock);
-    for (const TUniquePtr<FNsTween>& Instance : TweenPool)
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnImmediateReserved");
+    if (!IsInGameThread())
     {
-        if (Instance && Instance->GetHandle().Id.Value == Command.Handle.Id.Value)
-        {
-            Instance->SetPaused(false);
-            break;
-        }
+        return EnqueueSpawn(ReservedHandle, MoveTemp(Spec));
     }
+
+    if (!ReservedHandle.IsValid())
+    {
+        return FNsTweenHandle();
+    }
+
+    FNsTweenColdData* Record = nullptr;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        Record = TakeReservedRecord(ReservedHandle);
+    }
+
+    return Record ? InsertImmediate(*Record, MoveTemp(Spec)) : FNsTweenHandle();
+}
+
+FNsTweenHandle UNsTweenSubsystem::SpawnImmediate(FNsTweenSpec&& Spec, TSharedPtr<ITweenValue> Strategy)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnImmediate");
+    if (!IsInGameThread())
+    {
+        return EnqueueSpawn(MoveTemp(Spec), MoveTemp(Strategy));
+    }
+
+    if (!Strategy.IsValid())
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Cannot spawn tween without strategy."));
+        return FNsTweenHandle();
+    }
+
+    FNsTweenColdData* Record = nullptr;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        Record = AcquireRecord(AllocateHandle());
+    }
+
+    Record->SetStrategy(MoveTemp(Strategy));
+    return InsertImmediate(*Record, MoveTemp(Spec));
+}
+
+FNsTweenHandle UNsTweenSubsystem::InsertImmediate(FNsTweenColdData& Record, FNsTweenSpec&& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::InsertImmediate");
+    FNsTweenColdData* RecordPtr = &Record;
+    TSharedPtr<IEasingCurve> Easing = CreateEasing(Spec);
+    if (!Easing.IsValid())
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Failed to create easing curve."));
+        ReleaseRecords(MakeArrayView(&RecordPtr, 1));
+        return FNsTweenHandle();
+    }
+
+    FNsTween Instance;
+    Instance.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+
+    // Resolved before the start value is shown, so a blend starts from where the superseded tween left the target.
+    // Mid-tick the claim waits for the pump; a tween that will queue there leaves the target alone until it runs.
+    const FNsTweenSpec& Started = Record.Spec;
+    if (!bTickingTweens && !ClaimTarget(Instance))
+    {
+        return Record.GetHandle();
+    }
+
+    // The target shows its start value this frame instead of popping from its old value on the next tick.
+    if (!bTickingTweens || !Started.Target.IsValid() || Started.Overwrite != ENsTweenOverwrite::Queue)
+    {
+        Instance.ApplyStart();
+    }
+
+    {
+        // Spawned from a tween callback: the pool is being ticked, so the tween waits for the next pump.
+        FWriteScopeLock WriteLock(PoolLock);
+        if (bTickingTweens)
+        {
+            PendingTweens.Add(Instance);
+        }
+        else
+        {
+            AddLive(Instance);
+        }
+    }
+    WakeTicker();
+
+    // Batched start values go out now; mid-tick, the tick's own flush applies them.
+    if (!bTickingTweens)
+    {
+        FlushBatchers();
+    }
+
+    return Record.GetHandle();
+}
+
+FNsTweenHandle UNsTweenSubsystem::SpawnAfter(const FNsTweenHandle& Predecessor, const FNsTweenHandle& ReservedHandle, FNsTweenSpec&& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnAfterReserved");
+    if (!ReservedHandle.IsValid())
+    {
+        return FNsTweenHandle();
+    }
+
+    FNsTweenColdData* Record = nullptr;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        Record = TakeReservedRecord(ReservedHandle);
+    }
+
+    return Record ? LinkTween(Predecessor, *Record, MoveTemp(Spec)) : FNsTweenHandle();
+}
+
+FNsTweenHandle UNsTweenSubsystem::SpawnAfter(const FNsTweenHandle& Predecessor, FNsTweenSpec&& Spec, TSharedPtr<ITweenValue> Strategy)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnAfter");
+    if (!Strategy.IsValid())
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Cannot spawn tween without strategy."));
+        return FNsTweenHandle();
+    }
+
+    FNsTweenColdData* Record = nullptr;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        Record = AcquireRecord(AllocateHandle());
+    }
+
+    Record->SetStrategy(MoveTemp(Strategy));
+    return LinkTween(Predecessor, *Record, MoveTemp(Spec));
+}
+
+FNsTweenHandle UNsTweenSubsystem::LinkTween(const FNsTweenHandle& Predecessor, FNsTweenColdData& Record, FNsTweenSpec&& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::LinkTween");
+    FNsTweenColdData* RecordPtr = &Record;
+    TSharedPtr<IEasingCurve> Easing = CreateEasing(Spec);
+    if (!Easing.IsValid())
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Failed to create easing curve."));
+        ReleaseRecords(MakeArrayView(&RecordPtr, 1));
+        return FNsTweenHandle();
+    }
+
+    // Started now, like a direct spawn, so the tick only has to move it into the pool.
+    FNsTween Instance;
+    Instance.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+
+    FWriteScopeLock WriteLock(PoolLock);
+    Successors.FindOrAdd(Predecessor.Id).Add(Instance);
+    return Record.GetHandle();
+}
+
+void UNsTweenSubsystem::StartSuccessors(const FNsTweenHandle& Predecessor, float LeftoverSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::StartSuccessors");
+    // Game thread, mid-tick: successors join the pool behind the tweens being ticked, so indices stay valid.
+    TArray<FNsTween, TInlineAllocator<1>> Ready;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        if (!Successors.RemoveAndCopyValue(Predecessor.Id, Ready))
+        {
+            return;
+        }
+    }
+
+    // Successors queued on their target's next tween wait again instead of joining the pool.
+    const int32 First = TweenPool.Num();
+    for (FNsTween& Next : Ready)
+    {
+        if (ClaimTarget(Next))
+        {
+            FWriteScopeLock WriteLock(PoolLock);
+            AddLive(Next);
+        }
+    }
+
+    // Successors started below append their own behind Last and tick them with their own leftover.
+    const int32 Last = TweenPool.Num();
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        // Clock-driven successors pick up their clock on the next frame.
+        FNsTween& Next = TweenPool[Index];
+        if (Next.GetClock().IsValid())
+        {
+            continue;
+        }
+
+        float NextLeftoverSeconds = -1.f;
+        if (!Next.Tick(LeftoverSeconds, NextLeftoverSeconds))
+        {
+            // A successor shorter than the leftover hands the rest on in the same tick.
+            const FNsTweenHandle FinishedHandle = Next.GetHandle();
+            if (NextLeftoverSeconds >= 0.f)
+            {
+                StartSuccessors(FinishedHandle, NextLeftoverSeconds);
+            }
+            else
+            {
+                DropSuccessors(FinishedHandle);
+            }
+        }
+    }
+}
+
+void UNsTweenSubsystem::DropSuccessors(const FNsTweenHandle& Predecessor)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::DropSuccessors");
+    TArray<FNsTween, TInlineAllocator<1>> Dropped;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        if (!Successors.RemoveAndCopyValue(Predecessor.Id, Dropped))
+        {
+            return;
+        }
+    }
+
+    // Dropped successors never ran, so no completion fires; their own successors go with them.
+    TArray<FNsTweenColdData*, TInlineAllocator<4>> Records;
+    for (const FNsTween& Linked : Dropped)
+    {
+        DropSuccessors(Linked.GetHandle());
+        Records.Add(Linked.GetColdData());
+    }
+    ReleaseRecords(Records);
+}
+
+void UNsTweenSubsystem::EnqueueCancel(const FNsTweenHandle& Handle, bool bApplyFinal)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueCancel");
+    if (!Handle.IsValid()) return;
+
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::Cancel;
+    Command.Handle = Handle;
+    Command.bApplyFinalOnCancel = bApplyFinal;
+    CommandQueue.Enqueue(Command);
+    WakeTicker();
+}
+
+void UNsTweenSubsystem::EnqueuePause(const FNsTweenHandle& Handle)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueuePause");
+    if (!Handle.IsValid()) return;
+
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::Pause;
+    Command.Handle = Handle;
+    CommandQueue.Enqueue(Command);
+    WakeTicker();
+}
+
+void UNsTweenSubsystem::EnqueueResume(const FNsTweenHandle& Handle)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueResume");
+    if (!Handle.IsValid()) return;
+
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::Resume;
+    Command.Handle = Handle;
+    CommandQueue.Enqueue(Command);
+    WakeTicker();
+}
+
+void UNsTweenSubsystem::EnqueueSetTimeScale(const FNsTweenHandle& Handle, float TimeScale)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSetTimeScale");
+    if (!Handle.IsValid()) return;
+
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::SetTimeScale;
+    Command.Handle = Handle;
+    Command.Spec.TimeScale = TimeScale;
+    CommandQueue.Enqueue(MoveTemp(Command));
+    WakeTicker();
+}
+
+void UNsTweenSubsystem::EnqueueSetDuration(const FNsTweenHandle& Handle, float DurationSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSetDuration");
+    if (!Handle.IsValid()) return;
+
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::SetDuration;
+    Command.Handle = Handle;
+    Command.Spec.DurationSeconds = DurationSeconds;
+    CommandQueue.Enqueue(MoveTemp(Command));
+    WakeTicker();
+}
+
+void UNsTweenSubsystem::EnqueueSetEasing(const FNsTweenHandle& Handle, const FNsTweenSpec& Easing)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSetEasing");
+    if (!Handle.IsValid()) return;
+
+    // Only the easing fields travel; the curve is built on the game thread when the command runs.
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::SetEasing;
+    Command.Handle = Handle;
+    Command.Spec.EasingPreset = Easing.EasingPreset;
+    Command.Spec.BezierControlPoints = Easing.BezierControlPoints;
+    Command.Spec.CurveAsset = Easing.CurveAsset;
+    CommandQueue.Enqueue(MoveTemp(Command));
+    WakeTicker();
+}
+
+void UNsTweenSubsystem::EnqueueSetEndValue(const FNsTweenHandle& Handle, const FNsTweenValue& EndValue, bool bVelocityContinuous)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::EnqueueSetEndValue");
+    if (!Handle.IsValid()) return;
+
+    FNsTweenCommand Command;
+    Command.Type = ENsTweenCommandType::SetEndValue;
+    Command.Handle = Handle;
+    Command.EndValue = MakeShared<const FNsTweenValue>(EndValue);
+    Command.bVelocityContinuous = bVelocityContinuous;
+    CommandQueue.Enqueue(MoveTemp(Command));
+    WakeTicker();
+}
+
+bool UNsTweenSubsystem::IsActive(const FNsTweenHandle& Handle) const
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::IsActive");
+    FReadScopeLock ReadLock(PoolLock);
+    return FindLiveTween(Handle) != nullptr;
+}
+
+void UNsTweenSubsystem::ProcessCommands()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ProcessCommands");
+
+    // Publish directly spawned tweens first so commands queued after their spawn can find them.
+    TArray<FNsTween, TInlineAllocator<8>> Contested;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        for (const FNsTween& Pending : PendingTweens)
+        {
+            if (Pending.GetColdData()->Spec.Target.IsValid())
+            {
+                Contested.Add(Pending);
+            }
+            else
+            {
+                AddLive(Pending);
+            }
+        }
+        PendingTweens.Reset();
+    }
+
+    // Tweens naming a target are resolved against the tween driving it, outside the lock.
+    for (FNsTween& Pending : Contested)
+    {
+        if (ClaimTarget(Pending))
+        {
+            FWriteScopeLock WriteLock(PoolLock);
+            AddLive(Pending);
+        }
+    }
+
+    FNsTweenCommand Command;
+    while (CommandQueue.Dequeue(Command))
+    {
+        switch (Command.Type)
+        {
+            case ENsTweenCommandType::Spawn:  SpawnTween(Command);  break;
+            case ENsTweenCommandType::Cancel: CancelTween(Command);  break;
+            case ENsTweenCommandType::Pause:  PauseTween(Command);   break;
+            case ENsTweenCommandType::Resume: ResumeTween(Command);  break;
+            case ENsTweenCommandType::SetTimeScale:
+            case ENsTweenCommandType::SetDuration:
+            case ENsTweenCommandType::SetEasing:
+            case ENsTweenCommandType::SetEndValue: UpdateTween(Command); break;
+            default: break;
+        }
+    }
+}
+
+void UNsTweenSubsystem::SpawnTween(FNsTweenCommand& Command)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::SpawnTween");
+    // The handle was handed out when the spawn was queued, so successors may already wait on it; a spawn that fails
+    // drops them like a cancelled predecessor.
+    if (!Command.Strategy.IsValid())
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Cannot spawn tween without strategy."));
+        DropSuccessors(Command.Handle);
+        return;
+    }
+
+    TSharedPtr<IEasingCurve> Easing = CreateEasing(Command.Spec);
+    if (!Easing.IsValid())
+    {
+        UE_LOG(LogNsTween, Warning, TEXT("Failed to create easing curve."));
+        DropSuccessors(Command.Handle);
+        return;
+    }
+
+    FNsTweenColdData* Record = nullptr;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        Record = AcquireRecord(Command.Handle);
+    }
+
+    Record->SetStrategy(MoveTemp(Command.Strategy));
+
+    FNsTween Instance;
+    Instance.Start(*Record, MoveTemp(Command.Spec), MoveTemp(Easing));
+    if (!ClaimTarget(Instance))
+    {
+        return;
+    }
+
+    FWriteScopeLock WriteLock(PoolLock);
+    AddLive(Instance);
+}
+
+void UNsTweenSubsystem::CancelTween(const FNsTweenCommand& Command)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::CancelTween");
+    FNsTween InstanceToCancel;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        if (const FNsTween* Live = FindLiveTween(Command.Handle))
+        {
+            InstanceToCancel = *Live;
+            RemoveLiveAtSwap(InstanceToCancel.GetColdData()->LiveIndex);
+        }
+    }
+
+    if (FNsTweenColdData* Record = InstanceToCancel.GetColdData())
+    {
+        InstanceToCancel.Cancel(Command.bApplyFinalOnCancel);
+        ReleaseRecords(MakeArrayView(&Record, 1));
+    }
+    else
+    {
+        // A successor still waiting on its chain is dropped without ever running.
+        FNsTweenColdData* Linked = nullptr;
+        {
+            FWriteScopeLock WriteLock(PoolLock);
+            for (TPair<FNsTweenId, TArray<FNsTween, TInlineAllocator<1>>>& Link : Successors)
+            {
+                const int32 Found = Link.Value.IndexOfByPredicate([&Command](const FNsTween& Candidate)
+                {
+                    return Candidate.GetHandle().Id.Value == Command.Handle.Id.Value;
+                });
+                if (Found != INDEX_NONE)
+                {
+                    Linked = Link.Value[Found].GetColdData();
+                    Link.Value.RemoveAtSwap(Found, EAllowShrinking::No);
+                    break;
+                }
+            }
+        }
+
+        if (Linked)
+        {
+            ReleaseRecords(MakeArrayView(&Linked, 1));
+        }
+    }
+
+    DropSuccessors(Command.Handle);
+}
+
+void UNsTweenSubsystem::PauseTween(const FNsTweenCommand& Command)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::PauseTween");
+    FWriteScopeLock WriteLock(PoolLock);
+    if (FNsTween* Instance = FindLiveTween(Command.Handle))
+    {
+        Instance->SetPaused(true);
+    }
+}
+
+void UNsTweenSubsystem::ResumeTween(const FNsTweenCommand& Command)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ResumeTween");
+    FWriteScopeLock WriteLock(PoolLock);
+    if (FNsTween* Instance = FindLiveTween(Command.Handle))
+    {
+        Instance->SetPaused(false);
+    }
+}
+
+void UNsTweenSubsystem::UpdateTween(const FNsTweenCommand& Command)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::UpdateTween");
+
+    // Built before taking the lock: curve asset easings read their asset.
+    TSharedPtr<IEasingCurve> Easing;
+    if (Command.Type == ENsTweenCommandType::SetEasing)
+    {
+        Easing = CreateEasing(Command.Spec);
+        if (!Easing.IsValid())
+        {
+            UE_LOG(LogNsTween, Warning, TEXT("Failed to create easing curve."));
+            return;
+        }
+    }
+
+    FWriteScopeLock WriteLock(PoolLock);
+    FNsTween* Instance = FindTween(Command.Handle);
+    if (!Instance)
+    {
+        return;
+    }
+
+    // The record is changed where it lives; strategy, easing and callbacks are kept.
+    switch (Command.Type)
+    {
+        case ENsTweenCommandType::SetTimeScale:
+            Instance->SetTimeScale(Command.Spec.TimeScale);
+            break;
+
+        case ENsTweenCommandType::SetDuration:
+            Instance->SetDuration(Command.Spec.DurationSeconds);
+            break;
+
+        case ENsTweenCommandType::SetEasing:
+        {
+            FNsTweenSpec& Spec = Instance->GetColdData()->Spec;
+            Spec.EasingPreset = Command.Spec.EasingPreset;
+            Spec.BezierControlPoints = Command.Spec.BezierControlPoints;
+            Spec.CurveAsset = Command.Spec.CurveAsset;
+            Instance->SetEasing(MoveTemp(Easing));
+            break;
+        }
+
+        case ENsTweenCommandType::SetEndValue:
+        {
+            if (!Command.EndValue.IsValid() || !Instance->SetEndValue(*Command.EndValue, GetLinearAlpha(*Instance), Command.bVelocityContinuous))
+            {
+                UE_LOG(LogNsTween, Warning, TEXT("Tween %u cannot take the new end value; its strategy does not retarget or tweens another type."), Command.Handle.Id.Value);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+float UNsTweenSubsystem::GetLinearAlpha(const FNsTween& Instance) const
+{
+    if (Instance.GetClock().IsValid())
+    {
+        const FNsTweenClock* TweenClock = FindClock(Instance.GetClock());
+        return TweenClock ? TweenClock->GetLinearAlpha() : 0.f;
+    }
+
+    return Instance.GetLinearAlpha();
+}
+
+void UNsTweenSubsystem::AddLive(const FNsTween& Instance)
+{
+    Instance.GetColdData()->LiveIndex = TweenPool.Add(Instance);
+}
+
+void UNsTweenSubsystem::RemoveLiveAtSwap(int32 Index)
+{
+    TweenPool[Index].GetColdData()->LiveIndex = INDEX_NONE;
+    TweenPool.RemoveAtSwap(Index, EAllowShrinking::No);
+
+    // The last record moved into the hole.
+    if (TweenPool.IsValidIndex(Index))
+    {
+        TweenPool[Index].GetColdData()->LiveIndex = Index;
+    }
+}
+
+FNsTween* UNsTweenSubsystem::FindLive(const FNsTweenColdData& Record)
+{
+    if (!TweenPool.IsValidIndex(Record.LiveIndex))
+    {
+        return nullptr;
+    }
+
+    FNsTween& Instance = TweenPool[Record.LiveIndex];
+    return Instance.GetColdData() == &Record && Instance.IsActive() ? &Instance : nullptr;
+}
+
+bool UNsTweenSubsystem::ClaimTarget(FNsTween& Incoming)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ClaimTarget");
+    FNsTweenColdData* Record = Incoming.GetColdData();
+    if (!Record || !Record->Spec.Target.IsValid())
+    {
+        return true;
+    }
+
+    FNsTween* SupersededInPlace = nullptr;
+    FNsTween Superseded;
+    {
+        FWriteScopeLock WriteLock(PoolLock);
+        FNsTweenColdData*& Owner = Targets.FindOrAdd(Record->Spec.Target);
+        FNsTween* Running = Owner && Owner != Record ? FindLive(*Owner) : nullptr;
+        if (Running)
+        {
+            switch (Record->Spec.Overwrite)
+            {
+                case ENsTweenOverwrite::Queue:
+                    // Waits like a Then successor, so it starts in the tick the running tween completes.
+                    Successors.FindOrAdd(Running->GetHandle().Id).Add(Incoming);
+                    return false;
+
+                case ENsTweenOverwrite::Blend:
+                    if (!Running->HandOverTo(Incoming, GetLinearAlpha(*Running)))
+                    {
+                        UE_LOG(LogNsTween, Verbose, TEXT("Tween %u cannot blend from tween %u; it is killed instead."), Record->GetHandle().Id.Value, Running->GetHandle().Id.Value);
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+
+            // Mid-tick the pool is being iterated: stop the old tween in place and let the tick compact it.
+            if (bTickingTweens)
+            {
+                SupersededInPlace = Running;
+            }
+            else
+            {
+                Superseded = *Running;
+                RemoveLiveAtSwap(Owner->LiveIndex);
+            }
+        }
+
+        Owner = Record;
+    }
+
+    // Stopped outside the lock: completion callbacks may spawn or cancel tweens.
+    if (SupersededInPlace)
+    {
+        const FNsTweenHandle SupersededHandle = SupersededInPlace->GetHandle();
+        SupersededInPlace->Cancel(/*bApplyFinal*/ false);
+        DropSuccessors(SupersededHandle);
+    }
+    else if (FNsTweenColdData* SupersededRecord = Superseded.GetColdData())
+    {
+        Superseded.Cancel(/*bApplyFinal*/ false);
+        DropSuccessors(Superseded.GetHandle());
+        ReleaseRecords(MakeArrayView(&SupersededRecord, 1));
+    }
+
+    return true;
+}
+
+FNsTween* UNsTweenSubsystem::FindTween(const FNsTweenHandle& Handle)
+{
+    if (FNsTween* Live = FindLiveTween(Handle))
+    {
+        return Live;
+    }
+
+    // Only a tween waiting on its chain is known without being live; pending and reserved ones take no commands.
+    FNsTweenColdData* const* Record = RecordsByHandle.Find(Handle.Id);
+    if (!Record || (*Record)->LiveIndex != INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    for (TPair<FNsTweenId, TArray<FNsTween, TInlineAllocator<1>>>& Link : Successors)
+    {
+        for (FNsTween& Linked : Link.Value)
+        {
+            if (Linked.GetColdData() == *Record)
+            {
+                return &Linked;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+FNsTween* UNsTweenSubsystem::FindLiveTween(const FNsTweenHandle& Handle)
+{
+    return const_cast<FNsTween*>(static_cast<const UNsTweenSubsystem*>(this)->FindLiveTween(Handle));
+}
+
+const FNsTween* UNsTweenSubsystem::FindLiveTween(const FNsTweenHandle& Handle) const
+{
+    FNsTweenColdData* const* Record = RecordsByHandle.Find(Handle.Id);
+    if (!Record || !TweenPool.IsValidIndex((*Record)->LiveIndex))
+    {
+        return nullptr;
+    }
+
+    const FNsTween& Instance = TweenPool[(*Record)->LiveIndex];
+    return Instance.GetColdData() == *Record && Instance.IsActive() ? &Instance : nullptr;
 }
 
 TSharedPtr<IEasingCurve> UNsTweenSubsystem::CreateEasing(const FNsTweenSpec& Spec) const
 {
     NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::CreateEasing");
-    switch (Spec.EasingPreset)
+    return FNsTweenEasingFactory::Create(Spec);
+}
+
+FNsTweenColdData* UNsTweenSubsystem::AcquireRecord(const FNsTweenHandle& Handle)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::AcquireRecord");
+    // Caller holds PoolLock. Free records are already reset, so only the handle needs assigning.
+    FNsTweenColdData* Record = nullptr;
+    if (FreeTweens.Num() > 0)
+    {
+        Record = FreeTweens.Pop(EAllowShrinking::No);
+        ++RecycledRecords;
+    }
+    else
+    {
+        Record = AllocateRecord();
+        ++AllocatedRecords;
+    }
+
+    Record->Handle = Handle;
+    RecordsByHandle.Add(Handle.Id, Record);
+    return Record;
+}
+
+FNsTweenColdData* UNsTweenSubsystem::AllocateRecord()
+{
+    FNsTweenColdData* Record = ColdTable.Add_GetRef(MakeUnique<FNsTweenColdData>()).Get();
+    Record->TableIndex = ColdTable.Num() - 1;
+    return Record;
+}
+
+void UNsTweenSubsystem::DiscardRecord(FNsTweenColdData& Record)
+{
+    // Destroys the record; the last one takes its slot in the table.
+    const int32 TableIndex = Record.TableIndex;
+    ColdTable.RemoveAtSwap(TableIndex, EAllowShrinking::No);
+    if (ColdTable.IsValidIndex(TableIndex))
     {
-        case ENsTweenEase::CustomBezier: return MakeShared<FNsTweenBezierEasing>(Spec.BezierControlPoints);
-        case ENsTweenEase::CurveAsset:   return MakeShared<FNsTweenCurveAssetEasingAdapter>(Spec.CurveAsset);
-        default:                         return MakeShared<FNsTweenPolynomialEasing>(Spec.EasingPreset);
+        ColdTable[TableIndex]->TableIndex = TableIndex;
+    }
+    ++DiscardedRecords;
+}
+
+void UNsTweenSubsystem::ReleaseRecords(TArrayView<FNsTweenColdData* const> Records)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSubsystem::ReleaseRecords");
+    // Reset outside the lock: tearing down strategies runs the destructors of user callables.
+    // Target keys are captured first because the reset clears the spec that holds them.
+    TArray<TPair<FNsTweenColdData*, FNsTweenTargetKey>, TInlineAllocator<8>> Claims;
+    TArray<FNsTweenId, TInlineAllocator<8>> HandleIds;
+    for (FNsTweenColdData* Record : Records)
+    {
+        if (!Record)
+        {
+            continue;
+        }
+
+        if (Record->Spec.Target.IsValid())
+        {
+            Claims.Emplace(Record, Record->Spec.Target);
+        }
+
+        HandleIds.Add(Record->GetHandle().Id);
+        Record->Reset();
+    }
+
+    FWriteScopeLock WriteLock(PoolLock);
+
+    for (const FNsTweenId& HandleId : HandleIds)
+    {
+        RecordsByHandle.Remove(HandleId);
+    }
+
+    // A record still driving its target gives it up; one that was superseded no longer owns it.
+    for (const TPair<FNsTweenColdData*, FNsTweenTargetKey>& Claim : Claims)
+    {
+        FNsTweenColdData** Owner = Targets.Find(Claim.Value);
+        if (Owner && *Owner == Claim.Key)
+        {
+            Targets.Remove(Claim.Value);
+        }
+    }
+
+    // Records past the cap are freed with their strategy heap block; the rest keep it for the next spawn.
+    for (FNsTweenColdData* Record : Records)
+    {
+        if (!Record)
+        {
+            continue;
+        }
+
+        if (FreeTweens.Num() < MaxFreeTweens)
+        {
+            FreeTweens.Add(Record);
+        }
+        else
+        {
+            DiscardRecord(*Record);
+        }
     }
 }
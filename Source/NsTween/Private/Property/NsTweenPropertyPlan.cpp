@@ -0,0 +1,345 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Property/NsTweenPropertyPlan.h"
+#include "Kernels/NsTweenKernels.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UnrealType.h"
+#include "Utils/NsTweenLogging.h"
+#include "Utils/NsTweenProfiling.h"
+#include "ValueStrategies/TweenValue_Property.h"
+
+namespace NsTweenProperty
+{
+    /** Shared owner records keyed by object; entries expire with their last tween. */
+    TMap<FObjectKey, TWeakPtr<FNsTweenPropertyOwner>> Owners;
+
+    /** Owner count after the last prune, used to amortize pruning. */
+    int32 OwnersAfterPrune = 0;
+
+    /** Garbage collections completed since owners were first used; invalidates every cached owner pointer. */
+    uint32 Collections = 0;
+
+    /** Counts completed garbage collections. */
+    void OnPostGarbageCollect()
+    {
+        ++Collections;
+    }
+
+    template <typename T>
+    FORCEINLINE const T& Read(const uint8* Base, int32 Offset)
+    {
+        return *reinterpret_cast<const T*>(Base + Offset);
+    }
+
+    template <typename T>
+    FORCEINLINE T& Write(uint8* Base, int32 Offset)
+    {
+        return *reinterpret_cast<T*>(Base + Offset);
+    }
+
+    /** Resolves Path and builds a property strategy with empty endpoint buffers. */
+    TSharedPtr<FTweenValue_Property> MakeStrategy(UObject* Target, const FString& PropertyPath, const UScriptStruct* ValueStruct)
+    {
+        if (!Target)
+        {
+            UE_LOG(LogNsTween, Warning, TEXT("Cannot tween property '%s' without a target object."), *PropertyPath);
+            return nullptr;
+        }
+
+        FNsTweenPropertyPlan Plan;
+        FString Error;
+        if (!Plan.Resolve(Target->GetClass(), PropertyPath, ValueStruct, &Error))
+        {
+            UE_LOG(LogNsTween, Warning, TEXT("Cannot tween property '%s' on %s: %s"), *PropertyPath, *GetNameSafe(Target), *Error);
+            return nullptr;
+        }
+
+        return MakeShared<FTweenValue_Property>(FNsTweenPropertyOwner::FindOrAdd(Target), MoveTemp(Plan));
+    }
+}
+
+bool FNsTweenPropertyPlan::Resolve(const UStruct* OwnerStruct, const FString& Path, const UScriptStruct* ValueStruct, FString* OutError)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenPropertyPlan::Resolve");
+
+    auto Fail = [OutError, this](const FString& Message)
+    {
+        if (OutError)
+        {
+            *OutError = Message;
+        }
+        Channels.Reset();
+        return false;
+    };
+
+    BaseOffset = 0;
+    ValueSize = 0;
+    Channels.Reset();
+
+    TArray<FString> Segments;
+    Path.ParseIntoArray(Segments, TEXT("."));
+    if (!OwnerStruct || Segments.Num() == 0)
+    {
+        return Fail(TEXT("empty property path"));
+    }
+
+    const UStruct* Scope = OwnerStruct;
+    const FProperty* Leaf = nullptr;
+    for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+    {
+        const FProperty* Property = FindFProperty<FProperty>(Scope, *Segments[SegmentIndex]);
+        if (!Property)
+        {
+            return Fail(FString::Printf(TEXT("'%s' is not a property of %s"), *Segments[SegmentIndex], *Scope->GetName()));
+        }
+
+        if (Property->ArrayDim != 1)
+        {
+            return Fail(FString::Printf(TEXT("'%s' is a static array"), *Segments[SegmentIndex]));
+        }
+
+        BaseOffset += Property->GetOffset_ForInternal();
+        Leaf = Property;
+
+        if (SegmentIndex + 1 < Segments.Num())
+        {
+            const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+            if (!StructProperty)
+            {
+                return Fail(FString::Printf(TEXT("'%s' is not a struct and has no fields"), *Segments[SegmentIndex]));
+            }
+            Scope = StructProperty->Struct;
+        }
+    }
+
+    if (!ValueStruct)
+    {
+        if (Leaf->IsA<FFloatProperty>())
+        {
+            Channels.Add({ 0, ENsTweenPropertyChannelKind::Float });
+        }
+        else if (Leaf->IsA<FDoubleProperty>())
+        {
+            Channels.Add({ 0, ENsTweenPropertyChannelKind::Double });
+        }
+        else
+        {
+            return Fail(FString::Printf(TEXT("'%s' is not a float or double property"), *Path));
+        }
+
+        ValueSize = Leaf->GetElementSize();
+        return true;
+    }
+
+    const FStructProperty* LeafStruct = CastField<FStructProperty>(Leaf);
+    if (!LeafStruct || LeafStruct->Struct != ValueStruct)
+    {
+        return Fail(FString::Printf(TEXT("'%s' is not a %s property"), *Path, *ValueStruct->GetName()));
+    }
+
+    ValueSize = ValueStruct->GetStructureSize();
+    if (ValueSize > MaxValueSize)
+    {
+        return Fail(FString::Printf(TEXT("%s is larger than %d bytes"), *ValueStruct->GetName(), MaxValueSize));
+    }
+
+    AddStructChannels(ValueStruct, 0);
+    if (Channels.Num() == 0)
+    {
+        return Fail(FString::Printf(TEXT("%s has no float, double or rotation fields"), *ValueStruct->GetName()));
+    }
+
+    return true;
+}
+
+void FNsTweenPropertyPlan::AddStructChannels(const UScriptStruct* Struct, int32 Offset)
+{
+    if (Struct == TBaseStructure<FQuat>::Get())
+    {
+        Channels.Add({ Offset, ENsTweenPropertyChannelKind::Quat });
+        return;
+    }
+
+    if (Struct == TBaseStructure<FRotator>::Get())
+    {
+        Channels.Add({ Offset, ENsTweenPropertyChannelKind::Rotator });
+        return;
+    }
+
+    for (TFieldIterator<FProperty> It(Struct); It; ++It)
+    {
+        const FProperty* Field = *It;
+        if (Field->ArrayDim != 1)
+        {
+            continue;
+        }
+
+        const int32 FieldOffset = Offset + Field->GetOffset_ForInternal();
+        if (Field->IsA<FFloatProperty>())
+        {
+            Channels.Add({ FieldOffset, ENsTweenPropertyChannelKind::Float });
+        }
+        else if (Field->IsA<FDoubleProperty>())
+        {
+            Channels.Add({ FieldOffset, ENsTweenPropertyChannelKind::Double });
+        }
+        else if (const FStructProperty* Nested = CastField<FStructProperty>(Field))
+        {
+            AddStructChannels(Nested->Struct, FieldOffset);
+        }
+    }
+}
+
+void FNsTweenPropertyPlan::Blend(const uint8* A, const uint8* B, float Alpha, uint8* Dest) const
+{
+    using namespace NsTweenProperty;
+
+    for (const FNsTweenPropertyChannel& Channel : Channels)
+    {
+        switch (Channel.Kind)
+        {
+            case ENsTweenPropertyChannelKind::Float:
+            {
+                const float From = Read<float>(A, Channel.Offset);
+                Write<float>(Dest, Channel.Offset) = From + (Read<float>(B, Channel.Offset) - From) * Alpha;
+                break;
+            }
+            case ENsTweenPropertyChannelKind::Double:
+            {
+                const double From = Read<double>(A, Channel.Offset);
+                Write<double>(Dest, Channel.Offset) = From + (Read<double>(B, Channel.Offset) - From) * Alpha;
+                break;
+            }
+            case ENsTweenPropertyChannelKind::Quat:
+            {
+                Write<FQuat>(Dest, Channel.Offset) = FNsTweenKernels::SlerpQuat(Read<FQuat>(A, Channel.Offset), Read<FQuat>(B, Channel.Offset), FMath::Clamp(Alpha, 0.f, 1.f));
+                break;
+            }
+            case ENsTweenPropertyChannelKind::Rotator:
+            {
+                const FRotator& From = Read<FRotator>(A, Channel.Offset);
+                Write<FRotator>(Dest, Channel.Offset) = From + (Read<FRotator>(B, Channel.Offset) - From).GetNormalized() * Alpha;
+                break;
+            }
+        }
+    }
+}
+
+void FNsTweenPropertyPlan::Copy(const uint8* Source, uint8* Dest) const
+{
+    using namespace NsTweenProperty;
+
+    for (const FNsTweenPropertyChannel& Channel : Channels)
+    {
+        switch (Channel.Kind)
+        {
+            case ENsTweenPropertyChannelKind::Float:   Write<float>(Dest, Channel.Offset) = Read<float>(Source, Channel.Offset);       break;
+            case ENsTweenPropertyChannelKind::Double:  Write<double>(Dest, Channel.Offset) = Read<double>(Source, Channel.Offset);     break;
+            case ENsTweenPropertyChannelKind::Quat:    Write<FQuat>(Dest, Channel.Offset) = Read<FQuat>(Source, Channel.Offset);       break;
+            case ENsTweenPropertyChannelKind::Rotator: Write<FRotator>(Dest, Channel.Offset) = Read<FRotator>(Source, Channel.Offset); break;
+        }
+    }
+}
+
+void FNsTweenPropertyPlan::StoreScalar(double Value, uint8* Dest) const
+{
+    using namespace NsTweenProperty;
+
+    if (Channels.Num() != 1)
+    {
+        return;
+    }
+
+    switch (Channels[0].Kind)
+    {
+        case ENsTweenPropertyChannelKind::Float:  Write<float>(Dest, 0) = static_cast<float>(Value); break;
+        case ENsTweenPropertyChannelKind::Double: Write<double>(Dest, 0) = Value;                    break;
+        default: break;
+    }
+}
+
+TSharedRef<FNsTweenPropertyOwner> FNsTweenPropertyOwner::FindOrAdd(UObject* Object)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenPropertyOwner::FindOrAdd");
+    using namespace NsTweenProperty;
+
+    const FObjectKey Key(Object);
+    if (const TWeakPtr<FNsTweenPropertyOwner>* Existing = Owners.Find(Key))
+    {
+        if (TSharedPtr<FNsTweenPropertyOwner> Pinned = Existing->Pin())
+        {
+            return Pinned.ToSharedRef();
+        }
+    }
+
+    // Owners cache resolved pointers within a frame; a collection running mid-frame must invalidate them.
+    static const FDelegateHandle CollectionHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&OnPostGarbageCollect);
+
+    // Drop records whose tweens have all finished once the map has doubled since the last sweep.
+    if (Owners.Num() >= FMath::Max(2 * OwnersAfterPrune, 64))
+    {
+        for (auto It = Owners.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        OwnersAfterPrune = Owners.Num();
+    }
+
+    TSharedRef<FNsTweenPropertyOwner> Owner = MakeShared<FNsTweenPropertyOwner>();
+    Owner->Object = Object;
+    Owners.Add(Key, Owner);
+    return Owner;
+}
+
+UObject* FNsTweenPropertyOwner::Get()
+{
+    if (ValidatedFrame != GFrameCounter || ValidatedCollection != NsTweenProperty::Collections)
+    {
+        Resolved = Object.Get();
+        ValidatedFrame = GFrameCounter;
+        ValidatedCollection = NsTweenProperty::Collections;
+    }
+
+    return Resolved;
+}
+
+TSharedPtr<ITweenValue> MakeNsTweenPropertyStrategy(UObject* Target, const FString& PropertyPath, double StartValue, double EndValue)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::MakePropertyStrategy");
+
+    TSharedPtr<FTweenValue_Property> Strategy = NsTweenProperty::MakeStrategy(Target, PropertyPath, nullptr);
+    if (!Strategy)
+    {
+        return nullptr;
+    }
+
+    Strategy->GetPlan().StoreScalar(StartValue, Strategy->GetStartBuffer());
+    Strategy->GetPlan().StoreScalar(EndValue, Strategy->GetEndBuffer());
+    return Strategy;
+}
+
+TSharedPtr<ITweenValue> MakeNsTweenPropertyStrategy(UObject* Target, const FString& PropertyPath, const UScriptStruct* ValueStruct, const void* StartValue, const void* EndValue)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTween::MakePropertyStrategy");
+
+    if (!ValueStruct || !StartValue || !EndValue)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FTweenValue_Property> Strategy = NsTweenProperty::MakeStrategy(Target, PropertyPath, ValueStruct);
+    if (!Strategy)
+    {
+        return nullptr;
+    }
+
+    // Only the planned fields are ever read back, so copy those rather than constructing a struct in the buffers.
+    Strategy->GetPlan().Copy(static_cast<const uint8*>(StartValue), Strategy->GetStartBuffer());
+    Strategy->GetPlan().Copy(static_cast<const uint8*>(EndValue), Strategy->GetEndBuffer());
+    return Strategy;
+}
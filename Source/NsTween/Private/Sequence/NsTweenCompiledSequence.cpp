@@ -0,0 +1,150 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Sequence/NsTweenCompiledSequence.h"
+#include "Algo/BinarySearch.h"
+#include "Easing/NsTweenEasingFactory.h"
+#include "Easing/NsTweenPolynomialEasing.h"
+#include "Interfaces/IEasingCurve.h"
+#include "Utils/NsTweenProfiling.h"
+
+TSharedRef<FNsTweenCompiledSequence> FNsTweenCompiledSequence::Compile(TConstArrayView<FNsTweenSequenceItem> Items)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenCompiledSequence::Compile");
+    TSharedRef<FNsTweenCompiledSequence> Compiled = MakeShared<FNsTweenCompiledSequence>();
+    Compiled->ItemCount = Items.Num();
+    Compiled->Segments.Reserve(Items.Num());
+
+    // Group by track; the stable sort keeps authoring order within a track.
+    TArray<int32> Order;
+    Order.Reserve(Items.Num());
+    for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+    {
+        Order.Add(ItemIndex);
+    }
+    Order.StableSort([&Items](int32 A, int32 B) { return Items[A].Track < Items[B].Track; });
+
+    float TrackTime = 0.f;
+    for (const int32 ItemIndex : Order)
+    {
+        const FNsTweenSequenceItem& Item = Items[ItemIndex];
+        const FNsTweenSpec& Spec = Item.Spec;
+        if (Compiled->Tracks.Num() == 0 || Items[Compiled->Segments.Last().Item].Track != Item.Track)
+        {
+            Compiled->Tracks.AddDefaulted_GetRef().FirstSegment = Compiled->Segments.Num();
+            TrackTime = 0.f;
+        }
+
+        const float TimeScale = FMath::Max(Spec.TimeScale, KINDA_SMALL_NUMBER);
+        const int32 Loops = FMath::Max(Spec.LoopCount, 1);
+
+        FNsTweenSequenceSegment& Segment = Compiled->Segments.AddDefaulted_GetRef();
+        Segment.Item = ItemIndex;
+        Segment.Ease = Spec.EasingPreset;
+        Segment.WrapMode = Spec.WrapMode;
+        Segment.Direction = Spec.Direction;
+        Segment.RotationMode = Spec.RotationMode;
+        Segment.ColorMode = Spec.ColorMode;
+        Segment.CycleDuration = FMath::Max(Spec.DurationSeconds, SMALL_NUMBER) / TimeScale;
+        Segment.Cycles = Spec.WrapMode == ENsTweenWrapMode::Once ? 1 : (Spec.WrapMode == ENsTweenWrapMode::Loop ? Loops : Loops * 2);
+        Segment.StartTime = TrackTime + FMath::Max(Spec.DelaySeconds, 0.f) / TimeScale;
+        Segment.EndTime = Segment.StartTime + Segment.CycleDuration * Segment.Cycles;
+        ++Compiled->Tracks.Last().NumSegments;
+        TrackTime = Segment.EndTime;
+        Compiled->Duration = FMath::Max(Compiled->Duration, TrackTime);
+
+        // Bezier and curve asset easings are sampled once here, so players never solve a bezier or touch a curve.
+        if (Spec.EasingPreset == ENsTweenEase::CustomBezier || Spec.EasingPreset == ENsTweenEase::CurveAsset)
+        {
+            const TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+            Segment.SampleOffset = Compiled->Samples.AddUninitialized(BakedSamples);
+            for (int32 SampleIndex = 0; SampleIndex < BakedSamples; ++SampleIndex)
+            {
+                const float T = static_cast<float>(SampleIndex) / (BakedSamples - 1);
+                Compiled->Samples[Segment.SampleOffset + SampleIndex] = Easing.IsValid() ? Easing->Evaluate(T) : T;
+            }
+        }
+    }
+
+    return Compiled;
+}
+
+void FNsTweenCompiledSequence::Serialize(FArchive& Ar)
+{
+    Ar << Duration;
+    Ar << ItemCount;
+    Ar << Samples;
+
+    int32 NumTracks = Tracks.Num();
+    Ar << NumTracks;
+    if (Ar.IsLoading())
+    {
+        Tracks.SetNum(NumTracks);
+    }
+    for (FNsTweenSequenceTrack& Track : Tracks)
+    {
+        Ar << Track.FirstSegment;
+        Ar << Track.NumSegments;
+    }
+
+    int32 NumSegments = Segments.Num();
+    Ar << NumSegments;
+    if (Ar.IsLoading())
+    {
+        Segments.SetNum(NumSegments);
+    }
+    for (FNsTweenSequenceSegment& Segment : Segments)
+    {
+        Ar << Segment.StartTime;
+        Ar << Segment.EndTime;
+        Ar << Segment.CycleDuration;
+        Ar << Segment.Item;
+        Ar << Segment.Cycles;
+        Ar << Segment.SampleOffset;
+        Ar << Segment.Ease;
+        Ar << Segment.WrapMode;
+        Ar << Segment.Direction;
+        Ar << Segment.RotationMode;
+        Ar << Segment.ColorMode;
+    }
+}
+
+int32 FNsTweenCompiledSequence::FindSegment(int32 TrackIndex, float Time) const
+{
+    const FNsTweenSequenceTrack& Track = Tracks[TrackIndex];
+    const TConstArrayView<FNsTweenSequenceSegment> TrackSegments(Segments.GetData() + Track.FirstSegment, Track.NumSegments);
+    const int32 Upper = Algo::UpperBoundBy(TrackSegments, Time, &FNsTweenSequenceSegment::StartTime);
+    return Upper > 0 ? Track.FirstSegment + Upper - 1 : INDEX_NONE;
+}
+
+float FNsTweenCompiledSequence::EvaluateSegment(int32 SegmentIndex, float Time) const
+{
+    const FNsTweenSequenceSegment& Segment = Segments[SegmentIndex];
+    const float LocalTime = FMath::Clamp(Time - Segment.StartTime, 0.f, Segment.EndTime - Segment.StartTime);
+    const int32 Cycle = FMath::Min(FMath::FloorToInt(LocalTime / Segment.CycleDuration), Segment.Cycles - 1);
+    const float Phase = FMath::Clamp((LocalTime - Cycle * Segment.CycleDuration) / Segment.CycleDuration, 0.f, 1.f);
+
+    bool bForward = Segment.Direction != ENsTweenDirection::Backward;
+    if (Segment.WrapMode == ENsTweenWrapMode::PingPong && (Cycle & 1) != 0)
+    {
+        bForward = !bForward;
+    }
+
+    const float Alpha = bForward ? Phase : 1.f - Phase;
+    if (Segment.SampleOffset == INDEX_NONE)
+    {
+        return FNsTweenPolynomialEasing::EvaluatePreset(Segment.Ease, Alpha);
+    }
+
+    const float SamplePosition = Alpha * (BakedSamples - 1);
+    const int32 Lower = FMath::Min(FMath::FloorToInt(SamplePosition), BakedSamples - 2);
+    const float* Baked = Samples.GetData() + Segment.SampleOffset;
+    return FMath::Lerp(Baked[Lower], Baked[Lower + 1], SamplePosition - Lower);
+}
+
+FNsTweenSpec FNsTweenCompiledSequence::MakeBindingSpec(int32 SegmentIndex) const
+{
+    FNsTweenSpec Spec;
+    Spec.RotationMode = Segments[SegmentIndex].RotationMode;
+    Spec.ColorMode = Segments[SegmentIndex].ColorMode;
+    return Spec;
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "NsTweenTypeLibrary.h"
+#include "Sequence/NsTweenCompiledSequence.h"
+#include "Serialization/CustomVersion.h"
+#include "Utils/NsTweenProfiling.h"
+
+namespace NsTweenSequenceVersion
+{
+    enum Type : int32
+    {
+        /** Items only. */
+        Initial = 0,
+        /** The compiled timeline follows the items. */
+        CompiledBlob = 1,
+
+        LatestPlusOne,
+        Latest = LatestPlusOne - 1
+    };
+
+    const FGuid Guid(0x6A1E52C3, 0x4F0B4D27, 0x9C3E8B15, 0xD27A4F60);
+}
+
+static FCustomVersionRegistration GRegisterNsTweenSequenceVersion(NsTweenSequenceVersion::Guid, NsTweenSequenceVersion::Latest, TEXT("NsTweenSequence"));
+
+TSharedRef<const FNsTweenCompiledSequence> UNsTweenSequence::GetCompiled() const
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSequence::GetCompiled");
+    if (!Compiled.IsValid())
+    {
+        Compiled = FNsTweenCompiledSequence::Compile(Items);
+    }
+
+    return Compiled.ToSharedRef();
+}
+
+void UNsTweenSequence::Serialize(FArchive& Ar)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSequence::Serialize");
+    Super::Serialize(Ar);
+
+    Ar.UsingCustomVersion(NsTweenSequenceVersion::Guid);
+    if (!Ar.IsPersistent() || Ar.CustomVer(NsTweenSequenceVersion::Guid) < NsTweenSequenceVersion::CompiledBlob)
+    {
+        return;
+    }
+
+    if (Ar.IsSaving())
+    {
+        // Compiled from the saved items, never the cache, which may predate an edit.
+        TSharedRef<FNsTweenCompiledSequence> Blob = FNsTweenCompiledSequence::Compile(Items);
+        Blob->Serialize(Ar);
+    }
+    else if (Ar.IsLoading())
+    {
+        TSharedRef<FNsTweenCompiledSequence> Blob = MakeShared<FNsTweenCompiledSequence>();
+        Blob->Serialize(Ar);
+
+        // Editor builds recompile from Items so curve assets edited since the save are picked up.
+        if (FPlatformProperties::RequiresCookedData())
+        {
+            Compiled = Blob;
+        }
+    }
+}
+
+#if WITH_EDITOR
+void UNsTweenSequence::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    InvalidateCompiled();
+}
+#endif
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Slate/NsTweenSlate.h"
+#include "Slate/NsTweenSlateRunner.h"
+#include "Utils/NsTweenProfiling.h"
+#include "Widgets/SWidget.h"
+
+FNsTweenHandle FNsTweenSlate::Play(const TSharedRef<SWidget>& Widget, ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& StartValue, const FNsTweenWidgetState& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlate::Play");
+    return FNsTweenSlateRunner::FindOrAdd(Widget)->Play(Channels, StartValue, EndValue, Spec);
+}
+
+void FNsTweenSlate::Cancel(const TSharedRef<SWidget>& Widget, const FNsTweenHandle& Handle, bool bApplyFinal)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlate::Cancel");
+    if (const TSharedPtr<FNsTweenSlateRunner> Runner = FNsTweenSlateRunner::Find(Widget))
+    {
+        Runner->Cancel(Handle, bApplyFinal);
+    }
+}
+
+void FNsTweenSlate::CancelAll(const TSharedRef<SWidget>& Widget, bool bApplyFinal)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlate::CancelAll");
+    if (const TSharedPtr<FNsTweenSlateRunner> Runner = FNsTweenSlateRunner::Find(Widget))
+    {
+        Runner->CancelAll(bApplyFinal);
+    }
+}
+
+bool FNsTweenSlate::IsActive(const TSharedRef<SWidget>& Widget, const FNsTweenHandle& Handle)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlate::IsActive");
+    const TSharedPtr<FNsTweenSlateRunner> Runner = FNsTweenSlateRunner::Find(Widget);
+    return Runner.IsValid() && Runner->IsActive(Handle);
+}
+
+void FNsTweenSlate::SetColorSetter(const TSharedRef<SWidget>& Widget, TFunction<void(const FLinearColor&)> Setter)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlate::SetColorSetter");
+    FNsTweenSlateRunner::FindOrAdd(Widget)->SetColorSetter(MoveTemp(Setter));
+}
@@ -0,0 +1,289 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Slate/NsTweenSlateRunner.h"
+#include "Easing/NsTweenEasingFactory.h"
+#include "Interfaces/IEasingCurve.h"
+#include "Rendering/SlateRenderTransform.h"
+#include "Utils/NsTweenProfiling.h"
+#include "ValueStrategies/TweenValue_SlateWidget.h"
+#include "Widgets/SWidget.h"
+
+namespace NsTweenSlate
+{
+    /** Runners keyed by widget; an entry is dropped when its runner's last tween ends. */
+    TMap<const SWidget*, TSharedRef<FNsTweenSlateRunner>> Runners;
+
+    /** Runner count after the last prune, used to amortize pruning. */
+    int32 RunnersAfterPrune = 0;
+
+    /** Handle ids for Slate tweens. */
+    int32 NextHandleId = 0;
+}
+
+FNsTweenSlateRunner::FNsTweenSlateRunner(const TSharedRef<SWidget>& InWidget)
+    : Widget(InWidget)
+{
+}
+
+TSharedRef<FNsTweenSlateRunner> FNsTweenSlateRunner::FindOrAdd(const TSharedRef<SWidget>& InWidget)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlateRunner::FindOrAdd");
+    using namespace NsTweenSlate;
+
+    if (TSharedPtr<FNsTweenSlateRunner> Existing = Find(InWidget))
+    {
+        return Existing.ToSharedRef();
+    }
+
+    // Widgets destroyed mid-animation never tick their timer again; sweep their runners once the map has doubled.
+    if (Runners.Num() >= FMath::Max(2 * RunnersAfterPrune, 64))
+    {
+        for (auto It = Runners.CreateIterator(); It; ++It)
+        {
+            if (!It.Value()->Widget.IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        RunnersAfterPrune = Runners.Num();
+    }
+
+    TSharedRef<FNsTweenSlateRunner> Runner = MakeShared<FNsTweenSlateRunner>(InWidget);
+    Runners.Add(&InWidget.Get(), Runner);
+    return Runner;
+}
+
+TSharedPtr<FNsTweenSlateRunner> FNsTweenSlateRunner::Find(const TSharedRef<SWidget>& InWidget)
+{
+    using namespace NsTweenSlate;
+
+    // A destroyed widget's address can be reused by a new one, so the runner must still point at this widget.
+    const TSharedRef<FNsTweenSlateRunner>* Existing = Runners.Find(&InWidget.Get());
+    if (Existing && (*Existing)->Widget.Pin() == InWidget)
+    {
+        return *Existing;
+    }
+
+    return nullptr;
+}
+
+FNsTweenHandle FNsTweenSlateRunner::Play(ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& StartValue, const FNsTweenWidgetState& EndValue, const FNsTweenSpec& Spec)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlateRunner::Play");
+    const TSharedPtr<SWidget> Pinned = Widget.Pin();
+    TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+    if (!Pinned || !Easing.IsValid() || Channels == ENsTweenWidgetChannel::None)
+    {
+        return FNsTweenHandle();
+    }
+
+    FEntry Entry;
+    Entry.Record = MakeUnique<FNsTweenColdData>();
+    Entry.Record->Handle.Id.Value = ++NsTweenSlate::NextHandleId;
+    Entry.Record->EmplaceStrategy<FTweenValue_SlateWidget>(*this, Channels, StartValue, EndValue);
+    Entry.Tween.Start(*Entry.Record, FNsTweenSpec(Spec), MoveTemp(Easing));
+    const FNsTweenHandle Handle = Entry.Record->GetHandle();
+
+    (bTicking ? PendingEntries : Entries).Add(MoveTemp(Entry));
+
+    if (!bTimerRegistered)
+    {
+        Pinned->RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &FNsTweenSlateRunner::Tick));
+        bTimerRegistered = true;
+    }
+
+    return Handle;
+}
+
+void FNsTweenSlateRunner::Cancel(const FNsTweenHandle& Handle, bool bApplyFinal)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlateRunner::Cancel");
+    for (TArray<FEntry>* List : { &Entries, &PendingEntries })
+    {
+        for (FEntry& Entry : *List)
+        {
+            if (Entry.Tween.IsActive() && Entry.Tween.GetHandle().Id == Handle.Id)
+            {
+                Entry.Tween.Cancel(bApplyFinal);
+            }
+        }
+    }
+
+    // Outside a tick the final value is shown now rather than on the next frame.
+    if (!bTicking)
+    {
+        Compact();
+        if (const TSharedPtr<SWidget> Pinned = Widget.Pin())
+        {
+            ApplyState(*Pinned);
+        }
+    }
+}
+
+void FNsTweenSlateRunner::CancelAll(bool bApplyFinal)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlateRunner::CancelAll");
+    for (TArray<FEntry>* List : { &Entries, &PendingEntries })
+    {
+        for (FEntry& Entry : *List)
+        {
+            if (Entry.Tween.IsActive())
+            {
+                Entry.Tween.Cancel(bApplyFinal);
+            }
+        }
+    }
+
+    if (!bTicking)
+    {
+        Compact();
+        if (const TSharedPtr<SWidget> Pinned = Widget.Pin())
+        {
+            ApplyState(*Pinned);
+        }
+    }
+}
+
+bool FNsTweenSlateRunner::IsActive(const FNsTweenHandle& Handle) const
+{
+    for (const TArray<FEntry>* List : { &Entries, &PendingEntries })
+    {
+        for (const FEntry& Entry : *List)
+        {
+            if (Entry.Tween.IsActive() && Entry.Tween.GetHandle().Id == Handle.Id)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void FNsTweenSlateRunner::Write(ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& InState)
+{
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Translation))
+    {
+        State.Translation = InState.Translation;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Scale))
+    {
+        State.Scale = InState.Scale;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Shear))
+    {
+        State.Shear = InState.Shear;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Angle))
+    {
+        State.Angle = InState.Angle;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Opacity))
+    {
+        State.Opacity = InState.Opacity;
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Color))
+    {
+        State.Color = InState.Color;
+    }
+
+    DirtyChannels |= Channels;
+}
+
+EActiveTimerReturnType FNsTweenSlateRunner::Tick(double /*CurrentTime*/, float DeltaTime)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSlateRunner::Tick");
+    const TSharedPtr<SWidget> Pinned = Widget.Pin();
+
+    bTicking = true;
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].Tween.IsActive())
+        {
+            Entries[Index].Tween.Tick(DeltaTime);
+        }
+    }
+    bTicking = false;
+
+    Compact();
+
+    if (Pinned)
+    {
+        ApplyState(*Pinned);
+    }
+
+    if (!Pinned || Entries.Num() == 0)
+    {
+        // The delegate keeps this runner alive until the callback returns, so dropping the map entry is safe here.
+        bTimerRegistered = false;
+        if (Pinned)
+        {
+            NsTweenSlate::Runners.Remove(Pinned.Get());
+        }
+        return EActiveTimerReturnType::Stop;
+    }
+
+    return EActiveTimerReturnType::Continue;
+}
+
+void FNsTweenSlateRunner::Compact()
+{
+    Entries.RemoveAll([](const FEntry& Entry)
+    {
+        return !Entry.Tween.IsActive();
+    });
+
+    for (FEntry& Pending : PendingEntries)
+    {
+        if (Pending.Tween.IsActive())
+        {
+            Entries.Add(MoveTemp(Pending));
+        }
+    }
+    PendingEntries.Reset();
+}
+
+void FNsTweenSlateRunner::ApplyState(SWidget& Target)
+{
+    if (DirtyChannels == ENsTweenWidgetChannel::None)
+    {
+        return;
+    }
+
+    // A runner recreated for a widget knows nothing of its current values, so the first write of a channel always goes out.
+    // All transform channels go out as one render transform, built the same way as UMG's widget transform.
+    if (EnumHasAnyFlags(DirtyChannels, ENsTweenWidgetChannel::RenderTransform)
+        && (!EnumHasAnyFlags(AppliedChannels, ENsTweenWidgetChannel::RenderTransform) || State.Translation != Applied.Translation
+            || State.Scale != Applied.Scale || State.Shear != Applied.Shear || State.Angle != Applied.Angle))
+    {
+        const FSlateRenderTransform Transform = ::Concatenate(
+            FScale2D(State.Scale),
+            FShear2D::FromShearAngles(State.Shear),
+            FQuat2D(FMath::DegreesToRadians(State.Angle)),
+            FVector2D(State.Translation));
+        Target.SetRenderTransform(TOptional<FSlateRenderTransform>(Transform));
+        Applied.Translation = State.Translation;
+        Applied.Scale = State.Scale;
+        Applied.Shear = State.Shear;
+        Applied.Angle = State.Angle;
+        AppliedChannels |= ENsTweenWidgetChannel::RenderTransform;
+    }
+
+    if (EnumHasAnyFlags(DirtyChannels, ENsTweenWidgetChannel::Opacity)
+        && (!EnumHasAnyFlags(AppliedChannels, ENsTweenWidgetChannel::Opacity) || State.Opacity != Applied.Opacity))
+    {
+        Target.SetRenderOpacity(State.Opacity);
+        Applied.Opacity = State.Opacity;
+        AppliedChannels |= ENsTweenWidgetChannel::Opacity;
+    }
+
+    if (EnumHasAnyFlags(DirtyChannels, ENsTweenWidgetChannel::Color) && ColorSetter
+        && (!EnumHasAnyFlags(AppliedChannels, ENsTweenWidgetChannel::Color) || State.Color != Applied.Color))
+    {
+        ColorSetter(State.Color);
+        Applied.Color = State.Color;
+        AppliedChannels |= ENsTweenWidgetChannel::Color;
+    }
+
+    DirtyChannels = ENsTweenWidgetChannel::None;
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "Batching/NsTweenWidgetBatcher.h"
+#include "CoreMinimal.h"
+#include "NsTween.h"
+#include "Types/WidgetActiveTimerDelegate.h"
+
+class SWidget;
+
+/** Runs the Slate tweens of one widget from an active timer registered on that widget while tweens run. */
+class FNsTweenSlateRunner : public TSharedFromThis<FNsTweenSlateRunner>
+{
+public:
+    explicit FNsTweenSlateRunner(const TSharedRef<SWidget>& InWidget);
+
+    /** Returns the runner of a widget, creating it on first use. */
+    static TSharedRef<FNsTweenSlateRunner> FindOrAdd(const TSharedRef<SWidget>& Widget);
+
+    /** Returns the runner of a widget if it has one. */
+    static TSharedPtr<FNsTweenSlateRunner> Find(const TSharedRef<SWidget>& Widget);
+
+    /** Starts a tween on the widget and makes sure the active timer is registered. */
+    FNsTweenHandle Play(ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& StartValue, const FNsTweenWidgetState& EndValue, const FNsTweenSpec& Spec);
+
+    /** Cancels one tween. */
+    void Cancel(const FNsTweenHandle& Handle, bool bApplyFinal);
+
+    /** Cancels every tween. */
+    void CancelAll(bool bApplyFinal);
+
+    /** Returns true while the tween is running. */
+    bool IsActive(const FNsTweenHandle& Handle) const;
+
+    /** Sets how the color channel is applied. */
+    void SetColorSetter(TFunction<void(const FLinearColor&)> InColorSetter) { ColorSetter = MoveTemp(InColorSetter); }
+
+    /** Records channel values applied to the widget at the end of the frame. */
+    void Write(ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& InState);
+
+private:
+    /** A running tween and the cold record it owns. */
+    struct FEntry
+    {
+        FNsTween Tween;
+        TUniquePtr<FNsTweenColdData> Record;
+    };
+
+    /** Active timer callback. */
+    EActiveTimerReturnType Tick(double CurrentTime, float DeltaTime);
+
+    /** Drops cancelled and finished tweens and publishes tweens started during the tick. */
+    void Compact();
+
+    /** Applies the channels written since the last call. */
+    void ApplyState(SWidget& Target);
+
+private:
+    /** Animated widget. */
+    TWeakPtr<SWidget> Widget;
+
+    /** Applies the color channel; set by the typed color entry point. */
+    TFunction<void(const FLinearColor&)> ColorSetter;
+
+    /** Latest written channel values. */
+    FNsTweenWidgetState State;
+
+    /** Channel values last applied to the widget. */
+    FNsTweenWidgetState Applied;
+
+    /** Channels written since the last apply. */
+    ENsTweenWidgetChannel DirtyChannels = ENsTweenWidgetChannel::None;
+
+    /** Channels this runner has applied at least once; the others are always written, whatever Applied holds. */
+    ENsTweenWidgetChannel AppliedChannels = ENsTweenWidgetChannel::None;
+
+    /** True while the active timer is registered. */
+    bool bTimerRegistered = false;
+
+    /** True while tweens are being ticked; Entries must not be restructured then. */
+    bool bTicking = false;
+
+    /** Running tweens. */
+    TArray<FEntry> Entries;
+
+    /** Tweens started from callbacks during a tick. */
+    TArray<FEntry> PendingEntries;
+};
@@ -0,0 +1,315 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Spring/NsTweenSpring.h"
+#include "Utils/NsTweenProfiling.h"
+
+FNsTweenSpringStep FNsTweenSpringStep::Make(float AngularFrequency, float DampingRatio, float DeltaSeconds)
+{
+    FNsTweenSpringStep Step;
+    const double Omega = FMath::Max(AngularFrequency, 0.f);
+    const double Zeta = FMath::Max(DampingRatio, 0.f);
+    const double Time = DeltaSeconds;
+    if (Omega < SMALL_NUMBER || Time <= 0.0)
+    {
+        return Step;
+    }
+
+    if (FMath::IsNearlyEqual(Zeta, 1.0, 1.e-4))
+    {
+        // Critically damped: x(t) = (x0 + (v0 + w x0) t) e^(-w t).
+        const double Decay = FMath::Exp(-Omega * Time);
+        const double TimeDecay = Time * Decay;
+        const double OmegaTimeDecay = Omega * TimeDecay;
+        Step.PosPos = OmegaTimeDecay + Decay;
+        Step.PosVel = TimeDecay;
+        Step.VelPos = -Omega * OmegaTimeDecay;
+        Step.VelVel = Decay - OmegaTimeDecay;
+    }
+    else if (Zeta < 1.0)
+    {
+        // Under-damped: decaying oscillation at the damped frequency.
+        const double OmegaZeta = Omega * Zeta;
+        const double Damped = Omega * FMath::Sqrt(1.0 - Zeta * Zeta);
+        const double Decay = FMath::Exp(-OmegaZeta * Time);
+        const double DecaySin = Decay * FMath::Sin(Damped * Time);
+        const double DecayCos = Decay * FMath::Cos(Damped * Time);
+        const double ScaledSin = OmegaZeta * DecaySin / Damped;
+        Step.PosPos = DecayCos + ScaledSin;
+        Step.PosVel = DecaySin / Damped;
+        Step.VelPos = -DecaySin * Damped - OmegaZeta * ScaledSin;
+        Step.VelVel = DecayCos - ScaledSin;
+    }
+    else
+    {
+        // Over-damped: sum of two decaying exponentials with rates Z1 > Z2.
+        const double Root = Omega * FMath::Sqrt(Zeta * Zeta - 1.0);
+        const double Z1 = -Omega * Zeta + Root;
+        const double Z2 = -Omega * Zeta - Root;
+        const double E1 = FMath::Exp(Z1 * Time);
+        const double E2 = FMath::Exp(Z2 * Time);
+        const double InvSpread = 1.0 / (2.0 * Root);
+        Step.PosPos = (Z1 * E2 - Z2 * E1) * InvSpread;
+        Step.PosVel = (E1 - E2) * InvSpread;
+        Step.VelPos = Z1 * Z2 * (E2 - E1) * InvSpread;
+        Step.VelVel = (Z1 * E1 - Z2 * E2) * InvSpread;
+    }
+
+    return Step;
+}
+
+FNsTweenSpringHandle FNsTweenSpringPool::Create(int32 NumChannels, const double* Initial, const FNsTweenSpringSpec& Spec, FWriteFunction Write)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSpringPool::Create");
+    if (NumChannels <= 0 || NumChannels > MaxChannels || !Initial)
+    {
+        return FNsTweenSpringHandle();
+    }
+
+    int32 Index = INDEX_NONE;
+    if (FreeSlots.Num() > 0)
+    {
+        Index = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        if (NumSlots == Chunks.Num() * ChunkSize)
+        {
+            Chunks.Add(MakeUnique<FChunk>());
+        }
+        Index = NumSlots++;
+    }
+
+    FSpring& Spring = At(Index);
+    for (int32 Channel = 0; Channel < MaxChannels; ++Channel)
+    {
+        const double Value = Channel < NumChannels ? Initial[Channel] : 0.0;
+        Spring.Value[Channel] = Value;
+        Spring.Target[Channel] = Value;
+        Spring.Velocity[Channel] = 0.0;
+    }
+    Spring.Write = MoveTemp(Write);
+    Spring.AngularFrequency = 2.f * PI * FMath::Max(Spec.Frequency, 0.f);
+    Spring.DampingRatio = FMath::Max(Spec.DampingRatio, 0.f);
+    Spring.SettleThreshold = FMath::Max(Spec.SettleThreshold, 0.f);
+    Spring.AwakeIndex = INDEX_NONE;
+    Spring.NumChannels = static_cast<uint8>(NumChannels);
+    Spring.bInUse = true;
+    ++NumSprings;
+
+    FNsTweenSpringHandle Handle;
+    Handle.Index = Index;
+    Handle.Serial = Spring.Serial;
+    return Handle;
+}
+
+void FNsTweenSpringPool::Release(const FNsTweenSpringHandle& Handle)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSpringPool::Release");
+    FSpring* Spring = Find(Handle);
+    if (!Spring)
+    {
+        return;
+    }
+
+    Sleep(*Spring);
+    Spring->bInUse = false;
+    ++Spring->Serial;
+    --NumSprings;
+
+    // A write function may release its own spring; it is destroyed once it has returned.
+    if (bWriting)
+    {
+        DeferredFrees.Add(Handle.Index);
+    }
+    else
+    {
+        FreeSlot(Handle.Index);
+    }
+}
+
+bool FNsTweenSpringPool::SetTarget(const FNsTweenSpringHandle& Handle, int32 NumChannels, const double* Target)
+{
+    FSpring* Spring = Find(Handle);
+    if (!Spring || Spring->NumChannels != NumChannels)
+    {
+        return false;
+    }
+
+    // The velocity is kept, so a moving target bends the motion instead of restarting it.
+    FMemory::Memcpy(Spring->Target, Target, NumChannels * sizeof(double));
+    if (Spring->AwakeIndex == INDEX_NONE)
+    {
+        Spring->AwakeIndex = Awake.Add(Handle.Index);
+    }
+    return true;
+}
+
+bool FNsTweenSpringPool::GetValue(const FNsTweenSpringHandle& Handle, int32 NumChannels, double* OutChannels) const
+{
+    const FSpring* Spring = Find(Handle);
+    if (!Spring || Spring->NumChannels != NumChannels)
+    {
+        return false;
+    }
+
+    FMemory::Memcpy(OutChannels, Spring->Value, NumChannels * sizeof(double));
+    return true;
+}
+
+bool FNsTweenSpringPool::IsValid(const FNsTweenSpringHandle& Handle) const
+{
+    return Find(Handle) != nullptr;
+}
+
+void FNsTweenSpringPool::Tick(float DeltaSeconds)
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSpringPool::Tick");
+    if (Awake.Num() == 0 || DeltaSeconds <= 0.f)
+    {
+        return;
+    }
+
+    // Springs sharing a spec, the common case, share one step per frame.
+    FNsTweenSpringStep Step;
+    float StepFrequency = -1.f;
+    float StepDamping = -1.f;
+
+    Moved.Reset();
+    for (int32 AwakeIndex = Awake.Num() - 1; AwakeIndex >= 0; --AwakeIndex)
+    {
+        const int32 Index = Awake[AwakeIndex];
+        FSpring& Spring = At(Index);
+        if (Spring.AngularFrequency != StepFrequency || Spring.DampingRatio != StepDamping)
+        {
+            StepFrequency = Spring.AngularFrequency;
+            StepDamping = Spring.DampingRatio;
+            Step = FNsTweenSpringStep::Make(StepFrequency, StepDamping, DeltaSeconds);
+        }
+
+        const double SettleSpeed = static_cast<double>(Spring.SettleThreshold) * Spring.AngularFrequency;
+        bool bSettled = true;
+        for (int32 Channel = 0; Channel < Spring.NumChannels; ++Channel)
+        {
+            const double Offset = Spring.Value[Channel] - Spring.Target[Channel];
+            const double Velocity = Spring.Velocity[Channel];
+            const double NewOffset = Step.PosPos * Offset + Step.PosVel * Velocity;
+            const double NewVelocity = Step.VelPos * Offset + Step.VelVel * Velocity;
+            Spring.Value[Channel] = Spring.Target[Channel] + NewOffset;
+            Spring.Velocity[Channel] = NewVelocity;
+            bSettled &= FMath::Abs(NewOffset) <= Spring.SettleThreshold && FMath::Abs(NewVelocity) <= SettleSpeed;
+        }
+
+        // Iterating backwards, the spring swapped into this position has already been stepped.
+        if (bSettled)
+        {
+            FMemory::Memcpy(Spring.Value, Spring.Target, sizeof(Spring.Value));
+            FMemory::Memzero(Spring.Velocity, sizeof(Spring.Velocity));
+            Sleep(Spring);
+        }
+
+        Moved.Emplace(Index, Spring.Serial);
+    }
+
+    // Write functions run once every spring has moved, so they may create, retarget or release springs.
+    bWriting = true;
+    for (const TPair<int32, uint32>& Entry : Moved)
+    {
+        FSpring& Spring = At(Entry.Key);
+        if (Spring.bInUse && Spring.Serial == Entry.Value && Spring.Write)
+        {
+            double Channels[MaxChannels];
+            FMemory::Memcpy(Channels, Spring.Value, sizeof(Channels));
+            Spring.Write(Channels);
+        }
+    }
+    bWriting = false;
+
+    for (const int32 Index : DeferredFrees)
+    {
+        FreeSlot(Index);
+    }
+    DeferredFrees.Reset();
+}
+
+void FNsTweenSpringPool::Reset()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSpringPool::Reset");
+    for (int32 Index = 0; Index < NumSlots; ++Index)
+    {
+        const FSpring& Spring = At(Index);
+        if (Spring.bInUse)
+        {
+            FNsTweenSpringHandle Handle;
+            Handle.Index = Index;
+            Handle.Serial = Spring.Serial;
+            Release(Handle);
+        }
+    }
+}
+
+void FNsTweenSpringPool::Empty()
+{
+    NSTWEEN_SCOPE_CYCLE_COUNTER("NsTweenSpringPool::Empty");
+    check(!bWriting);
+    Chunks.Empty();
+    NumSlots = 0;
+    NumSprings = 0;
+    FreeSlots.Empty();
+    Awake.Empty();
+    Moved.Empty();
+    DeferredFrees.Empty();
+}
+
+SIZE_T FNsTweenSpringPool::GetAllocatedSize() const
+{
+    return Chunks.Num() * sizeof(FChunk)
+        + Chunks.GetAllocatedSize()
+        + FreeSlots.GetAllocatedSize()
+        + Awake.GetAllocatedSize()
+        + Moved.GetAllocatedSize()
+        + DeferredFrees.GetAllocatedSize();
+}
+
+FNsTweenSpringPool::FSpring* FNsTweenSpringPool::Find(const FNsTweenSpringHandle& Handle)
+{
+    if (Handle.Index < 0 || Handle.Index >= NumSlots)
+    {
+        return nullptr;
+    }
+
+    FSpring& Spring = At(Handle.Index);
+    return (Spring.bInUse && Spring.Serial == Handle.Serial) ? &Spring : nullptr;
+}
+
+const FNsTweenSpringPool::FSpring* FNsTweenSpringPool::Find(const FNsTweenSpringHandle& Handle) const
+{
+    if (Handle.Index < 0 || Handle.Index >= NumSlots)
+    {
+        return nullptr;
+    }
+
+    const FSpring& Spring = At(Handle.Index);
+    return (Spring.bInUse && Spring.Serial == Handle.Serial) ? &Spring : nullptr;
+}
+
+void FNsTweenSpringPool::Sleep(FSpring& Spring)
+{
+    if (Spring.AwakeIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    const int32 Removed = Spring.AwakeIndex;
+    Awake.RemoveAtSwap(Removed, EAllowShrinking::No);
+    if (Awake.IsValidIndex(Removed))
+    {
+        At(Awake[Removed]).AwakeIndex = Removed;
+    }
+    Spring.AwakeIndex = INDEX_NONE;
+}
+
+void FNsTweenSpringPool::FreeSlot(int32 Index)
+{
+    At(Index).Write.Reset();
+    FreeSlots.Add(Index);
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenTransformBatcher.h"
+#include "Components/SceneComponent.h"
+#include "Misc/AutomationTest.h"
+#include "ValueStrategies/TweenValue_ComponentTransform.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenAdditiveLayerTest, "NsTween.Batching.AdditiveLayers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenAdditiveLayerTest::RunTest(const FString& Parameters)
+{
+    FNsTweenTransformBatcher Batcher;
+    USceneComponent* Component = NewObject<USceneComponent>();
+    const FNsTweenSpec Spec;
+
+    FNsTweenMoveOptions Additive;
+    Additive.bAdditive = true;
+    FNsTweenMoveOptions HalfWeight = Additive;
+    HalfWeight.Weight = 0.5f;
+
+    FTweenValue_ComponentTransform Move(Batcher, Component, ENsTweenTransformChannel::Location, FTransform(FVector::ZeroVector), FTransform(FVector(100.0, 0.0, 0.0)), FNsTweenMoveOptions());
+    FTweenValue_ComponentTransform Bob(Batcher, Component, ENsTweenTransformChannel::Location, FTransform(FVector::ZeroVector), FTransform(FVector(0.0, 0.0, 10.0)), Additive);
+    Move.Prepare(Spec);
+    Bob.Prepare(Spec);
+
+    {
+        FTweenValue_ComponentTransform Shake(Batcher, Component, ENsTweenTransformChannel::Location, FTransform(FVector::ZeroVector), FTransform(FVector(0.0, 10.0, 0.0)), HalfWeight);
+        Shake.Prepare(Spec);
+
+        Move.Apply(0.5f);
+        Bob.Apply(0.5f);
+        Shake.Apply(1.f);
+        Batcher.Flush();
+        TestEqual(TEXT("Layers are summed on top of the override in one move"), Batcher.GetLastFlushCount(), 1);
+        TestEqual(TEXT("Weighted layers add their scaled offset"), Component->GetRelativeLocation(), FVector(50.0, 5.0, 5.0), 1.e-3);
+
+        Bob.Apply(1.f);
+        Shake.Apply(1.f);
+        Batcher.Flush();
+        TestEqual(TEXT("Layers do not accumulate across frames"), Component->GetRelativeLocation(), FVector(50.0, 5.0, 10.0), 1.e-3);
+    }
+
+    Bob.Apply(1.f);
+    Batcher.Flush();
+    TestEqual(TEXT("A layer stopped early takes its offset with it"), Component->GetRelativeLocation(), FVector(50.0, 0.0, 10.0), 1.e-3);
+
+    Component->SetRelativeLocation(FVector(200.0, 0.0, 0.0));
+    Bob.ApplyFinal();
+    Batcher.Flush();
+    TestEqual(TEXT("Moves made outside the batcher become the base"), Component->GetRelativeLocation(), FVector(200.0, 0.0, 10.0), 1.e-3);
+
+    FTweenValue_ComponentTransform Idle(Batcher, Component, ENsTweenTransformChannel::Location, FTransform(FVector::ZeroVector), FTransform(FVector::ZeroVector), Additive);
+    Idle.Apply(0.f);
+    Batcher.Flush();
+    TestEqual(TEXT("A completed layer keeps its end offset"), Component->GetRelativeLocation(), FVector(200.0, 0.0, 10.0), 1.e-3);
+
+    // A paused layer writes nothing, but keeps its offset while a sibling moves the component.
+    USceneComponent* Held = NewObject<USceneComponent>();
+    FTweenValue_ComponentTransform Slide(Batcher, Held, ENsTweenTransformChannel::Location, FTransform(FVector::ZeroVector), FTransform(FVector(100.0, 0.0, 0.0)), FNsTweenMoveOptions());
+    FTweenValue_ComponentTransform Hover(Batcher, Held, ENsTweenTransformChannel::Location, FTransform(FVector::ZeroVector), FTransform(FVector(0.0, 0.0, 10.0)), Additive);
+    Slide.Prepare(Spec);
+    Hover.Prepare(Spec);
+
+    Slide.Apply(0.5f);
+    Hover.Apply(0.5f);
+    Batcher.Flush();
+    Slide.Apply(1.f);
+    Batcher.Flush();
+    TestEqual(TEXT("A paused layer keeps its offset under an override"), Held->GetRelativeLocation(), FVector(100.0, 0.0, 5.0), 1.e-3);
+
+    Hover.Apply(0.6f);
+    Batcher.Flush();
+    TestEqual(TEXT("A resumed layer carries on without a pop"), Held->GetRelativeLocation(), FVector(100.0, 0.0, 6.0), 1.e-3);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Templates/NsTweenBufferStrategy.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenBufferTest, "NsTween.Strategies.Buffer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenBufferTest::RunTest(const FString& Parameters)
+{
+    // Seven elements cover both the four-lane pass and the scalar tail.
+    TArray<float> Weights;
+    Weights.SetNumZeroed(7);
+    TArray<float> WeightsStart;
+    TArray<float> WeightsEnd;
+    for (int32 Index = 0; Index < Weights.Num(); ++Index)
+    {
+        WeightsStart.Add(0.f);
+        WeightsEnd.Add(static_cast<float>(Index));
+    }
+
+    TNsTweenBufferValue<float> FloatTween(Weights, WeightsStart, WeightsEnd);
+    FloatTween.Apply(0.5f);
+    TestEqual(TEXT("Float buffer head is blended"), Weights[2], 1.f);
+    TestEqual(TEXT("Float buffer tail is blended"), Weights[6], 3.f);
+
+    TArray<FVector> Points = { FVector::ZeroVector, FVector::ZeroVector };
+    TNsTweenBufferValue<FVector> VectorTween(Points, { FVector::ZeroVector, FVector(1.0) }, { FVector(2.0, 4.0, 6.0), FVector(3.0) });
+    VectorTween.Apply(0.5f);
+    TestEqual(TEXT("Vector buffer is blended per component"), Points[0], FVector(1.0, 2.0, 3.0));
+    TestEqual(TEXT("Vector buffer keeps element order"), Points[1], FVector(2.0));
+
+    VectorTween.ApplyFinal();
+    TestEqual(TEXT("Final snapshot is exact"), Points[1], FVector(3.0));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Easing/NsTweenEasingFactory.h"
+#include "Misc/AutomationTest.h"
+#include "NsTween.h"
+#include "ValueStrategies/TweenValue_Float.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenChainingLeftoverTest, "NsTween.Chaining.Leftover", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenChainingLeftoverTest::RunTest(const FString& Parameters)
+{
+    float Value = 0.f;
+    FNsTweenSpec Spec;
+    Spec.DurationSeconds = 1.f;
+    Spec.TimeScale = 2.f;
+    Spec.EasingPreset = ENsTweenEase::Linear;
+
+    FNsTweenColdData Record;
+    Record.EmplaceStrategy<FTweenValue_Float>(&Value, 0.f, 10.f);
+    TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+
+    FNsTween Tween;
+    Tween.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+
+    float LeftoverSeconds = 0.f;
+    TestTrue(TEXT("Tween runs mid-way"), Tween.Tick(0.25f, LeftoverSeconds));
+    TestTrue(TEXT("No leftover while running"), LeftoverSeconds < 0.f);
+
+    TestFalse(TEXT("Tween completes"), Tween.Tick(0.5f, LeftoverSeconds));
+    TestEqual(TEXT("Leftover is the unused real time"), LeftoverSeconds, 0.25f, 1.e-4f);
+    TestEqual(TEXT("Final value applied"), Value, 10.f);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenChainingFailedPredecessorTest, "NsTween.Chaining.FailedPredecessor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenChainingFailedPredecessorTest::RunTest(const FString& Parameters)
+{
+    // A successor that tries to spawn builds its strategy first, so a factory call means it would have played.
+    bool bSuccessorSpawned = false;
+    auto MakeSuccessor = [&bSuccessorSpawned]()
+    {
+        return FNsTween::Play(FNsTweenSpec(), [&bSuccessorSpawned]() -> TSharedPtr<ITweenValue>
+        {
+            bSuccessorSpawned = true;
+            return nullptr;
+        });
+    };
+
+    {
+        FNsTweenBuilder Failing = FNsTween::Play(FNsTweenSpec(), []() -> TSharedPtr<ITweenValue> { return nullptr; });
+        Failing.Then(MakeSuccessor());
+    }
+    TestFalse(TEXT("A predecessor that fails to spawn never starts its successor"), bSuccessorSpawned);
+
+    {
+        FNsTweenBuilder Empty;
+        Empty.Then(MakeSuccessor()).Join(MakeSuccessor());
+    }
+    TestFalse(TEXT("Builders that cannot take a successor disarm it"), bSuccessorSpawned);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
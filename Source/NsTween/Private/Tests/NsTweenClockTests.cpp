@@ -0,0 +1,88 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Clock/NsTweenClock.h"
+#include "Easing/NsTweenEasingFactory.h"
+#include "Misc/AutomationTest.h"
+#include "NsTween.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenClockTest, "NsTween.Clock.Timing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenClockTest::RunTest(const FString& Parameters)
+{
+    FNsTweenSpec Timing;
+    Timing.DurationSeconds = 1.f;
+    Timing.DelaySeconds = 0.5f;
+    Timing.WrapMode = ENsTweenWrapMode::Loop;
+    Timing.LoopCount = 2;
+
+    FNsTweenClock Clock;
+    Clock.Start(Timing);
+
+    Clock.Advance(0.25f);
+    TestFalse(TEXT("Delay holds the clock"), Clock.HasMoved());
+
+    Clock.Advance(0.75f);
+    TestTrue(TEXT("Clock moves once the delay is consumed"), Clock.HasMoved());
+    TestEqual(TEXT("Remaining time carries past the delay"), Clock.GetLinearAlpha(), 0.5f, 1.e-4f);
+
+    Clock.SetPaused(true);
+    Clock.Advance(1.f);
+    TestFalse(TEXT("Paused clocks do not move"), Clock.HasMoved());
+
+    Clock.Seek(0.25f);
+    Clock.Advance(1.f);
+    TestTrue(TEXT("Seeking reports movement while paused"), Clock.HasMoved());
+    TestEqual(TEXT("Seek sets the cycle time"), Clock.GetLinearAlpha(), 0.25f, 1.e-4f);
+
+    Clock.SetPaused(false);
+    Clock.Advance(1.f);
+    TestEqual(TEXT("Crossing a boundary raises one loop event"), Clock.GetLoopEvents(), 1);
+    TestEqual(TEXT("Second cycle position"), Clock.GetLinearAlpha(), 0.25f, 1.e-4f);
+
+    Clock.Advance(5.f);
+    TestTrue(TEXT("Clock finishes after its loops"), Clock.IsFinished());
+    TestEqual(TEXT("Final loop is reported"), Clock.GetLoopEvents(), 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenClockCallbackTest, "NsTween.Clock.CallbackCreatesClock", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenClockCallbackTest::RunTest(const FString& Parameters)
+{
+    FNsTweenSpec Timing;
+    Timing.DurationSeconds = 1.f;
+    Timing.WrapMode = ENsTweenWrapMode::Loop;
+
+    // Stands in for the subsystem's clock slots: creating a clock from OnLoop grows the array and moves every clock.
+    TArray<FNsTweenClock> Clocks;
+    Clocks.AddDefaulted();
+    Clocks[0].Start(Timing);
+
+    float Value = -1.f;
+    FNsTweenSpec Spec;
+    Spec.EasingPreset = ENsTweenEase::Linear;
+    Spec.OnLoop.BindLambda([&Clocks]()
+    {
+        Clocks.AddDefaulted(64);
+        Clocks.Last().Start(FNsTweenSpec());
+    });
+
+    FNsTweenColdData Record;
+    Record.EmplaceStrategy<FNsTweenCallbackValue<float>>(0.f, 1.f, [&Value](const float& InValue) { Value = InValue; });
+    TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+    FNsTween Tween;
+    Tween.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+
+    float Leftover = -1.f;
+    Clocks[0].Advance(1.25f);
+    TestTrue(TEXT("Tween keeps running on a looping clock"), Tween.TickOnClock(Clocks[0].GetFrame(), Leftover));
+    TestTrue(TEXT("The loop callback created clocks"), Clocks.Num() > 1);
+    TestEqual(TEXT("The tween applies its own clock's time after the callback"), Value, 0.25f, 1.e-4f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
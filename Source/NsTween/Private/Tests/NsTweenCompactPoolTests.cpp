@@ -0,0 +1,46 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Compact/NsTweenCompactPool.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenCompactPoolTest, "NsTween.Compact.Pool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenCompactPoolTest::RunTest(const FString& Parameters)
+{
+    FNsTweenCompactPool Pool;
+    TArray<float> Values;
+    Values.SetNumZeroed(3);
+
+    TArray<int32> Completed;
+    const int32 BlockId = Pool.RegisterTargets(Values, FNsTweenCompactComplete::CreateLambda([&Completed](int32 TargetIndex)
+    {
+        Completed.Add(TargetIndex);
+    }));
+    TestTrue(TEXT("Block registers"), BlockId != INDEX_NONE);
+
+    TestTrue(TEXT("Spawn on a valid target"), Pool.Spawn(BlockId, 0, 0.f, 10.f, 1.f, ENsTweenEase::Linear, ENsTweenCompactFlags::NotifyComplete));
+    TestTrue(TEXT("Spawn a silent tween"), Pool.Spawn(BlockId, 2, 5.f, 7.f, 2.f, ENsTweenEase::Linear));
+    TestFalse(TEXT("Out-of-range targets are rejected"), Pool.Spawn(BlockId, 3, 0.f, 1.f, 1.f, ENsTweenEase::Linear));
+    TestFalse(TEXT("Bezier and curve easings are rejected"), Pool.Spawn(BlockId, 1, 0.f, 1.f, 1.f, ENsTweenEase::CustomBezier));
+    TestEqual(TEXT("Start value is written on spawn"), Values[2], 5.f);
+
+    Pool.Tick(0.5f);
+    TestEqual(TEXT("Halfway value"), Values[0], 5.f, 1.e-3f);
+    TestEqual(TEXT("Quarter value"), Values[2], 5.5f, 1.e-3f);
+
+    Pool.Tick(0.6f);
+    TestEqual(TEXT("Final value is exact"), Values[0], 10.f);
+    TestEqual(TEXT("Only flagged tweens notify"), Completed.Num(), 1);
+    TestEqual(TEXT("Notification carries the target index"), Completed.Num() > 0 ? Completed[0] : INDEX_NONE, 0);
+    TestEqual(TEXT("Finished records are recycled"), Pool.Num(), 1);
+
+    Pool.UnregisterTargets(BlockId);
+    TestEqual(TEXT("Unregistering stops the block's tweens"), Pool.Num(), 0);
+
+    AddInfo(FString::Printf(TEXT("Compact record: %d bytes"), static_cast<int32>(sizeof(FNsTweenCompactRecord))));
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "NsTweenTypeLibrary.h"
+#include "Templates/NsTweenFanOutStrategy.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenFanOutTest, "NsTween.Strategies.FanOut", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenFanOutTest::RunTest(const FString& Parameters)
+{
+    const FNsTweenSpec Spec;
+    TArray<float> Targets;
+    Targets.SetNumZeroed(8);
+    int32 Writes = 0;
+    auto Update = [&Targets, &Writes](int32 Index, const float& Value)
+    {
+        Targets[Index] = Value;
+        ++Writes;
+    };
+
+    TNsTweenFanOutValue<float, decltype(Update)> Shared(TArray<float>({ 0.f }), TArray<float>({ 10.f }), Targets.Num(), Update);
+    Shared.Prepare(Spec);
+    Shared.Apply(0.5f);
+    TestEqual(TEXT("Every target is written once"), Writes, Targets.Num());
+    TestEqual(TEXT("Shared endpoints broadcast one value"), Targets[7], 5.f);
+
+    TNsTweenFanOutValue<float, decltype(Update)> PerTarget(TArray<float>({ 0.f, 0.f }), TArray<float>({ 10.f, 20.f }), 2, Update);
+    PerTarget.Prepare(Spec);
+    PerTarget.Apply(0.5f);
+    TestEqual(TEXT("Per-target endpoints blend separately"), Targets[1], 10.f);
+
+    PerTarget.ApplyFinal();
+    TestEqual(TEXT("Final values are exact"), Targets[1], 20.f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,47 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Easing/NsTweenEasingFactory.h"
+#include "Misc/AutomationTest.h"
+#include "NsTween.h"
+#include "ValueStrategies/TweenValue_Float.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenApplyStartTest, "NsTween.Spawning.ApplyStart", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenApplyStartTest::RunTest(const FString& Parameters)
+{
+    int32 Updates = 0;
+    float Value = -1.f;
+    auto StartTween = [&Updates, &Value](FNsTweenColdData& Record, FNsTween& Tween, float DelaySeconds)
+    {
+        FNsTweenSpec Spec;
+        Spec.DurationSeconds = 1.f;
+        Spec.DelaySeconds = DelaySeconds;
+        Spec.EasingPreset = ENsTweenEase::Linear;
+        Spec.OnUpdate.BindLambda([&Updates](float) { ++Updates; });
+
+        Record.EmplaceStrategy<FTweenValue_Float>(&Value, 3.f, 10.f);
+        TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+        Tween.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+    };
+
+    FNsTweenColdData Record;
+    FNsTween Tween;
+    StartTween(Record, Tween, 0.f);
+    Tween.ApplyStart();
+    TestEqual(TEXT("Start value is applied before the first tick"), Value, 3.f);
+    TestEqual(TEXT("The start value is a regular update"), Updates, 1);
+
+    Value = -1.f;
+    FNsTweenColdData DelayedRecord;
+    FNsTween Delayed;
+    StartTween(DelayedRecord, Delayed, 0.5f);
+    Delayed.ApplyStart();
+    TestEqual(TEXT("Delayed tweens initialize their target"), Value, 3.f);
+    TestEqual(TEXT("Delayed tweens do not update during the delay"), Updates, 1);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
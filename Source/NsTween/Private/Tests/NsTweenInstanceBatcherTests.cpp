@@ -0,0 +1,88 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenInstanceBatcher.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Misc/AutomationTest.h"
+#include "ValueStrategies/TweenValue_InstanceSpan.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenInstanceBatcherTest, "NsTween.Batching.Instances", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenInstanceBatcherTest::RunTest(const FString& Parameters)
+{
+    FNsTweenInstanceBatcher Batcher;
+    UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>();
+    Component->SetNumCustomDataFloats(3);
+    for (int32 Index = 0; Index < 6; ++Index)
+    {
+        Component->AddInstance(FTransform(FVector(0.0, 0.0, 10.0 * Index)));
+    }
+
+    auto InstanceLocation = [Component](int32 Index)
+    {
+        FTransform Instance;
+        Component->GetInstanceTransform(Index, Instance);
+        return Instance.GetLocation();
+    };
+
+    const int32 Slot = Batcher.AcquireSlot(Component);
+    TestNull(TEXT("Empty spans are rejected"), Batcher.WriteTransforms(Slot, 0, 0));
+    TestNull(TEXT("Negative instances are rejected"), Batcher.WriteTransforms(Slot, -1, 1));
+    TestNull(TEXT("Empty custom data strides are rejected"), Batcher.WriteCustomData(Slot, 0, 1, 0, 0));
+
+    // Spans 0-1 and 4, then 1 again: the gap is resubmitted unchanged and the later write wins on the overlap.
+    FTransform* First = Batcher.WriteTransforms(Slot, 0, 2);
+    First[0] = FTransform(FVector(100.0, 0.0, 0.0));
+    First[1] = FTransform(FVector(200.0, 0.0, 0.0));
+    Batcher.WriteTransforms(Slot, 4, 1)[0] = FTransform(FVector(400.0, 0.0, 0.0));
+    Batcher.WriteTransforms(Slot, 1, 1)[0] = FTransform(FVector(300.0, 0.0, 0.0));
+
+    // Instances 5 to 7, of which only 5 exists.
+    FTransform* Clipped = Batcher.WriteTransforms(Slot, 5, 3);
+    for (int32 Index = 0; Index < 3; ++Index)
+    {
+        Clipped[Index] = FTransform(FVector(500.0, 0.0, 0.0));
+    }
+
+    // Two floats per instance starting at custom data index 1, laid out instance by instance.
+    float* CustomData = Batcher.WriteCustomData(Slot, 2, 2, 1, 2);
+    CustomData[0] = 1.f;
+    CustomData[1] = 2.f;
+    CustomData[2] = 3.f;
+    CustomData[3] = 4.f;
+
+    Batcher.Flush();
+    TestEqual(TEXT("One submission per component"), Batcher.GetLastFlushCount(), 1);
+    TestEqual(TEXT("First span is written"), InstanceLocation(0), FVector(100.0, 0.0, 0.0), 1.e-3);
+    TestEqual(TEXT("Later spans win on overlaps"), InstanceLocation(1), FVector(300.0, 0.0, 0.0), 1.e-3);
+    TestEqual(TEXT("Instances between spans are kept"), InstanceLocation(2), FVector(0.0, 0.0, 20.0), 1.e-3);
+    TestEqual(TEXT("Instances between spans are kept"), InstanceLocation(3), FVector(0.0, 0.0, 30.0), 1.e-3);
+    TestEqual(TEXT("Last span is written"), InstanceLocation(4), FVector(400.0, 0.0, 0.0), 1.e-3);
+    TestEqual(TEXT("Spans are clipped to the instance count"), InstanceLocation(5), FVector(500.0, 0.0, 0.0), 1.e-3);
+    TestEqual(TEXT("Clipped spans add no instances"), Component->GetInstanceCount(), 6);
+
+    const TArray<float>& Data = Component->PerInstanceSMCustomData;
+    TestEqual(TEXT("Floats before the stride are kept"), Data[2 * 3 + 0], 0.f);
+    TestEqual(TEXT("Stride starts at its custom data index"), Data[2 * 3 + 1], 1.f);
+    TestEqual(TEXT("Stride covers its floats"), Data[2 * 3 + 2], 2.f);
+    TestEqual(TEXT("Next instance starts a new stride"), Data[3 * 3 + 1], 3.f);
+    TestEqual(TEXT("Next instance starts a new stride"), Data[3 * 3 + 2], 4.f);
+    Batcher.ReleaseSlot(Slot);
+
+    // Span strategies interpolate transforms and custom data together.
+    const TArray<FTransform> Start = { FTransform(FVector::ZeroVector) };
+    const TArray<FTransform> End = { FTransform(FVector(100.0, 0.0, 0.0)) };
+    const TArray<float> StartData = { 0.f, 0.f };
+    const TArray<float> EndData = { 1.f, 2.f };
+    FTweenValue_InstanceSpan Span(Batcher, Component, 0, 1, Start, End, 1, 2, StartData, EndData);
+    Span.Apply(0.5f);
+    Batcher.Flush();
+    TestEqual(TEXT("Span transforms are interpolated"), InstanceLocation(0), FVector(50.0, 0.0, 0.0), 1.e-3);
+    TestEqual(TEXT("Span custom data is interpolated"), Data[1], 0.5f, 1.e-4f);
+    TestEqual(TEXT("Span custom data keeps its stride"), Data[2], 1.f, 1.e-4f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,295 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "HAL/PlatformTime.h"
+#include "Kernels/NsTweenEndpoints.h"
+#include "Kernels/NsTweenKernels.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+namespace NsTweenKernelTests
+{
+    /** Element count used by the throughput benchmark. */
+    constexpr int32 BenchmarkCount = 4096;
+
+    /** Passes used by the throughput benchmark. */
+    constexpr int32 BenchmarkPasses = 256;
+
+    /** Owning SoA storage for a batch of transforms. */
+    struct FTransformBuffers
+    {
+        TArray<double> Channels[10];
+
+        void Init(int32 Count)
+        {
+            for (TArray<double>& Channel : Channels)
+            {
+                Channel.SetNumZeroed(Count);
+            }
+        }
+
+        FNsTweenTransformSoA View()
+        {
+            FNsTweenTransformSoA Result;
+            Result.Translation = { Channels[0].GetData(), Channels[1].GetData(), Channels[2].GetData() };
+            Result.Rotation = { Channels[3].GetData(), Channels[4].GetData(), Channels[5].GetData(), Channels[6].GetData() };
+            Result.Scale = { Channels[7].GetData(), Channels[8].GetData(), Channels[9].GetData() };
+            return Result;
+        }
+
+        void Set(int32 Index, const FTransform& Transform)
+        {
+            const FVector T = Transform.GetTranslation();
+            const FQuat R = Transform.GetRotation();
+            const FVector S = Transform.GetScale3D();
+            const double Values[10] = { T.X, T.Y, T.Z, R.X, R.Y, R.Z, R.W, S.X, S.Y, S.Z };
+            for (int32 Channel = 0; Channel < 10; ++Channel)
+            {
+                Channels[Channel][Index] = Values[Channel];
+            }
+        }
+
+        FTransform Get(int32 Index) const
+        {
+            return FTransform(
+                FQuat(Channels[3][Index], Channels[4][Index], Channels[5][Index], Channels[6][Index]),
+                FVector(Channels[0][Index], Channels[1][Index], Channels[2][Index]),
+                FVector(Channels[7][Index], Channels[8][Index], Channels[9][Index]));
+        }
+    };
+
+    FTransform MakeRandomTransform(FRandomStream& Stream)
+    {
+        return FTransform(
+            FRotator(Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f)).Quaternion(),
+            FVector(Stream.FRandRange(-1.e6f, 1.e6f), Stream.FRandRange(-1.e6f, 1.e6f), Stream.FRandRange(-1.e6f, 1.e6f)),
+            FVector(Stream.FRandRange(0.1f, 4.f), Stream.FRandRange(0.1f, 4.f), Stream.FRandRange(0.1f, 4.f)));
+    }
+
+    /** Returns elements per second for a timed batch. */
+    double Throughput(double Seconds, int32 Elements)
+    {
+        return Seconds > 0.0 ? static_cast<double>(Elements) / Seconds : 0.0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenKernelCorrectnessTest, "NsTween.Kernels.Correctness", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenKernelCorrectnessTest::RunTest(const FString& Parameters)
+{
+    using namespace NsTweenKernelTests;
+
+    // Odd count so the scalar tail is exercised alongside the register passes.
+    constexpr int32 Count = 37;
+    FRandomStream Stream(1337);
+
+    FTransformBuffers Start;
+    FTransformBuffers End;
+    FTransformBuffers Out;
+    Start.Init(Count);
+    End.Init(Count);
+    Out.Init(Count);
+
+    TArray<float> Alpha;
+    Alpha.SetNumUninitialized(Count);
+
+    TArray<FTransform> StartTransforms;
+    TArray<FTransform> EndTransforms;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        StartTransforms.Add(MakeRandomTransform(Stream));
+        EndTransforms.Add(MakeRandomTransform(Stream));
+        Start.Set(Index, StartTransforms[Index]);
+        End.Set(Index, EndTransforms[Index]);
+        Alpha[Index] = Stream.FRand();
+    }
+
+    FNsTweenKernels::LerpTransforms(Start.View(), End.View(), Alpha.GetData(), Out.View(), Count);
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FTransform Batched = Out.Get(Index);
+        const FTransform Single = FNsTweenKernels::LerpTransform(StartTransforms[Index], EndTransforms[Index], Alpha[Index]);
+
+        const FVector ExpectedLocation = FMath::Lerp(StartTransforms[Index].GetTranslation(), EndTransforms[Index].GetTranslation(), static_cast<double>(Alpha[Index]));
+        const FQuat ExpectedRotation = FQuat::Slerp(StartTransforms[Index].GetRotation(), EndTransforms[Index].GetRotation(), Alpha[Index]).GetNormalized();
+
+        TestTrue(TEXT("Batched translation matches scalar lerp"), Batched.GetTranslation().Equals(ExpectedLocation, 1.e-3));
+        TestTrue(TEXT("Batched rotation matches scalar slerp"), Batched.GetRotation().Equals(ExpectedRotation, 1.e-4));
+        TestTrue(TEXT("Single value path matches batched path"), Single.Equals(Batched, 1.e-4));
+    }
+
+    // The uniform entry point must match the per-element one fed the same alpha everywhere.
+    const float SharedAlpha = Stream.FRand();
+    for (float& Value : Alpha)
+    {
+        Value = SharedAlpha;
+    }
+    FNsTweenKernels::LerpTransforms(Start.View(), End.View(), Alpha.GetData(), Out.View(), Count);
+
+    FTransformBuffers UniformOut;
+    UniformOut.Init(Count);
+    FNsTweenKernels::LerpTransformsUniform(Start.View(), End.View(), SharedAlpha, UniformOut.View(), Count);
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        TestTrue(TEXT("Uniform alpha path matches per-element path"), UniformOut.Get(Index).Equals(Out.Get(Index), 1.e-6));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenEndpointModesTest, "NsTween.Kernels.EndpointModes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenEndpointModesTest::RunTest(const FString& Parameters)
+{
+    const FRotator StartRotator(10.f, 170.f, 0.f);
+    const FRotator EndRotator(-20.f, -170.f, 45.f);
+
+    for (const ENsTweenRotationMode Mode : { ENsTweenRotationMode::Slerp, ENsTweenRotationMode::Nlerp, ENsTweenRotationMode::ShortestEuler })
+    {
+        FNsTweenRotationEndpoints Endpoints;
+        Endpoints.Prepare(StartRotator, EndRotator, Mode);
+        TestTrue(TEXT("Rotation starts at the start value"), Endpoints.EvaluateQuat(0.f).Equals(StartRotator.Quaternion(), 1.e-4));
+        TestTrue(TEXT("Rotation ends at the end value"), Endpoints.EvaluateQuat(1.f).Equals(EndRotator.Quaternion(), 1.e-4));
+    }
+
+    // Nlerp runs on the uniform double kernel; it must match the plain component blend.
+    FNsTweenRotationEndpoints NlerpEndpoints;
+    NlerpEndpoints.Prepare(StartRotator, EndRotator, ENsTweenRotationMode::Nlerp);
+    FQuat StartQuat = StartRotator.Quaternion();
+    FQuat EndQuat = EndRotator.Quaternion();
+    if ((StartQuat | EndQuat) < 0.0)
+    {
+        EndQuat = EndQuat * -1.0;
+    }
+    const FQuat NlerpReference = (StartQuat + (EndQuat - StartQuat) * 0.3f).GetNormalized();
+    TestTrue(TEXT("Nlerp kernel matches the component blend"), NlerpEndpoints.EvaluateQuat(0.3f).Equals(NlerpReference, 1.e-4));
+
+    // The euler path must wrap through 180 rather than sweep back through 0.
+    FNsTweenRotationEndpoints EulerEndpoints;
+    EulerEndpoints.Prepare(StartRotator, EndRotator, ENsTweenRotationMode::ShortestEuler);
+    TestTrue(TEXT("Shortest euler yaw wraps through 180"), FMath::Abs(EulerEndpoints.EvaluateRotator(0.5f).GetNormalized().Yaw) > 170.f);
+
+    const FLinearColor StartColor(1.f, 0.2f, 0.f, 1.f);
+    const FLinearColor EndColor(0.f, 0.4f, 1.f, 0.5f);
+
+    for (const ENsTweenColorMode Mode : { ENsTweenColorMode::RGB, ENsTweenColorMode::HSV, ENsTweenColorMode::OkLab })
+    {
+        FNsTweenColorEndpoints Endpoints;
+        Endpoints.Prepare(StartColor, EndColor, Mode);
+        TestTrue(TEXT("Color starts at the start value"), Endpoints.Evaluate(0.f).Equals(StartColor, 1.e-3f));
+        TestTrue(TEXT("Color ends at the end value"), Endpoints.Evaluate(1.f).Equals(EndColor, 1.e-3f));
+    }
+
+    // RGB blends run on the uniform float kernel; they must match the plain component blend.
+    FNsTweenColorEndpoints RGBEndpoints;
+    RGBEndpoints.Prepare(StartColor, EndColor, ENsTweenColorMode::RGB);
+    TestTrue(TEXT("RGB kernel matches the component blend"), RGBEndpoints.Evaluate(0.3f).Equals(StartColor + (EndColor - StartColor) * 0.3f, 1.e-5f));
+
+    const FLinearColor RoundTrip = FNsTweenColorEndpoints::OkLabToLinear(FNsTweenColorEndpoints::LinearToOkLab(StartColor));
+    TestTrue(TEXT("OkLab conversion round-trips"), RoundTrip.Equals(StartColor, 1.e-3f));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenKernelThroughputTest, "NsTween.Kernels.Throughput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+
+bool FNsTweenKernelThroughputTest::RunTest(const FString& Parameters)
+{
+    using namespace NsTweenKernelTests;
+
+    FRandomStream Stream(42);
+
+    FTransformBuffers Start;
+    FTransformBuffers End;
+    FTransformBuffers Out;
+    Start.Init(BenchmarkCount);
+    End.Init(BenchmarkCount);
+    Out.Init(BenchmarkCount);
+
+    TArray<float> Alpha;
+    TArray<float> FloatStart;
+    TArray<float> FloatEnd;
+    TArray<float> FloatOut;
+    Alpha.SetNumUninitialized(BenchmarkCount);
+    FloatStart.SetNumUninitialized(BenchmarkCount);
+    FloatEnd.SetNumUninitialized(BenchmarkCount);
+    FloatOut.SetNumUninitialized(BenchmarkCount);
+
+    TArray<FTransform> StartTransforms;
+    TArray<FTransform> EndTransforms;
+    TArray<FTransform> ScalarOut;
+    ScalarOut.SetNum(BenchmarkCount);
+
+    for (int32 Index = 0; Index < BenchmarkCount; ++Index)
+    {
+        StartTransforms.Add(MakeRandomTransform(Stream));
+        EndTransforms.Add(MakeRandomTransform(Stream));
+        Start.Set(Index, StartTransforms[Index]);
+        End.Set(Index, EndTransforms[Index]);
+        Alpha[Index] = Stream.FRand();
+        FloatStart[Index] = Stream.FRand();
+        FloatEnd[Index] = Stream.FRand();
+    }
+
+    const int32 Elements = BenchmarkCount * BenchmarkPasses;
+    const FNsTweenTransformSoA StartView = Start.View();
+    const FNsTweenTransformSoA EndView = End.View();
+    const FNsTweenTransformSoA OutView = Out.View();
+
+    double Begin = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < BenchmarkPasses; ++Pass)
+    {
+        FNsTweenKernels::LerpFloats(FloatStart.GetData(), FloatEnd.GetData(), Alpha.GetData(), FloatOut.GetData(), BenchmarkCount);
+    }
+    const double FloatSeconds = FPlatformTime::Seconds() - Begin;
+
+    Begin = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < BenchmarkPasses; ++Pass)
+    {
+        FNsTweenKernels::LerpVectors(StartView.Translation, EndView.Translation, Alpha.GetData(), OutView.Translation, BenchmarkCount);
+    }
+    const double VectorSeconds = FPlatformTime::Seconds() - Begin;
+
+    Begin = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < BenchmarkPasses; ++Pass)
+    {
+        FNsTweenKernels::SlerpQuats(StartView.Rotation, EndView.Rotation, Alpha.GetData(), OutView.Rotation, BenchmarkCount);
+    }
+    const double QuatSeconds = FPlatformTime::Seconds() - Begin;
+
+    Begin = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < BenchmarkPasses; ++Pass)
+    {
+        FNsTweenKernels::LerpTransforms(StartView, EndView, Alpha.GetData(), OutView, BenchmarkCount);
+    }
+    const double TransformSeconds = FPlatformTime::Seconds() - Begin;
+
+    // Reference: the per-tween decomposition the strategies used before the kernels existed.
+    Begin = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < BenchmarkPasses; ++Pass)
+    {
+        for (int32 Index = 0; Index < BenchmarkCount; ++Index)
+        {
+            const FTransform& A = StartTransforms[Index];
+            const FTransform& B = EndTransforms[Index];
+            FTransform& Result = ScalarOut[Index];
+            Result.SetLocation(FMath::Lerp(A.GetLocation(), B.GetLocation(), static_cast<double>(Alpha[Index])));
+            Result.SetRotation(FQuat::Slerp(A.GetRotation(), B.GetRotation(), Alpha[Index]).GetNormalized());
+            Result.SetScale3D(FMath::Lerp(A.GetScale3D(), B.GetScale3D(), static_cast<double>(Alpha[Index])));
+        }
+    }
+    const double ScalarTransformSeconds = FPlatformTime::Seconds() - Begin;
+
+    AddInfo(FString::Printf(TEXT("Float lerp:        %.2f M/s"), Throughput(FloatSeconds, Elements) / 1.e6));
+    AddInfo(FString::Printf(TEXT("Vector lerp:       %.2f M/s"), Throughput(VectorSeconds, Elements) / 1.e6));
+    AddInfo(FString::Printf(TEXT("Quat slerp:        %.2f M/s"), Throughput(QuatSeconds, Elements) / 1.e6));
+    AddInfo(FString::Printf(TEXT("Transform lerp:    %.2f M/s"), Throughput(TransformSeconds, Elements) / 1.e6));
+    AddInfo(FString::Printf(TEXT("Transform scalar:  %.2f M/s"), Throughput(ScalarTransformSeconds, Elements) / 1.e6));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
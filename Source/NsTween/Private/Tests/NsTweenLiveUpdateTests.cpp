@@ -0,0 +1,59 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Easing/NsTweenEasingFactory.h"
+#include "Misc/AutomationTest.h"
+#include "NsTween.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenLiveUpdateTest, "NsTween.LiveUpdate.InPlace", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenLiveUpdateTest::RunTest(const FString& Parameters)
+{
+    float Value = 0.f;
+    auto StartTween = [&Value](FNsTweenColdData& Record, FNsTween& Tween)
+    {
+        FNsTweenSpec Spec;
+        Spec.DurationSeconds = 1.f;
+        Spec.EasingPreset = ENsTweenEase::Linear;
+
+        Record.EmplaceStrategy<FNsTweenCallbackValue<float>>(0.f, 10.f, [&Value](const float& InValue) { Value = InValue; });
+        TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+        Tween.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+    };
+
+    FNsTweenColdData Record;
+    FNsTween Tween;
+    StartTween(Record, Tween);
+    Tween.Tick(0.5f);
+    Tween.SetDuration(2.f);
+    TestEqual(TEXT("Duration change keeps the progress"), Tween.GetLinearAlpha(), 0.5f, 1.e-4f);
+    Tween.SetTimeScale(2.f);
+    Tween.Tick(0.25f);
+    TestEqual(TEXT("New duration and time scale apply from the current progress"), Value, 7.5f, 1.e-3f);
+
+    FNsTweenColdData RetargetRecord;
+    FNsTween Retargeted;
+    StartTween(RetargetRecord, Retargeted);
+    Retargeted.Tick(0.5f);
+    TestTrue(TEXT("Callback tweens retarget"), Retargeted.SetEndValue(FNsTweenValue(TInPlaceType<float>(), 20.f), Retargeted.GetLinearAlpha(), false));
+    TestFalse(TEXT("Other value types are rejected"), Retargeted.SetEndValue(FNsTweenValue(TInPlaceType<FVector>(), FVector::OneVector), Retargeted.GetLinearAlpha(), false));
+    Retargeted.Tick(0.25f);
+    TestEqual(TEXT("The curve carries on from the value reached"), Value, 12.5f, 1.e-3f);
+    Retargeted.Tick(0.25f);
+    TestEqual(TEXT("The new end is reached on time"), Value, 20.f);
+
+    FNsTweenColdData SmoothRecord;
+    FNsTween Smooth;
+    StartTween(SmoothRecord, Smooth);
+    Smooth.Tick(0.5f);
+    Smooth.SetEndValue(FNsTweenValue(TInPlaceType<float>(), 20.f), Smooth.GetLinearAlpha(), true);
+    Smooth.Tick(0.01f);
+    TestEqual(TEXT("Velocity-continuous retargets keep the current speed"), Value, 5.1f, 0.02f);
+    Smooth.Tick(0.49f);
+    TestEqual(TEXT("Velocity-continuous retargets still end on the new value"), Value, 20.f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
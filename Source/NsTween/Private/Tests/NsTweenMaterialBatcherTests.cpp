@@ -0,0 +1,65 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenMaterialBatcher.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "ValueStrategies/TweenValue_MaterialParameter.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenMaterialBatcherTest, "NsTween.Batching.MaterialParameters", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenMaterialBatcherTest::RunTest(const FString& Parameters)
+{
+    FNsTweenMaterialBatcher Batcher;
+    UMaterialInstanceDynamic* Material = UMaterialInstanceDynamic::Create(UMaterial::GetDefaultMaterial(MD_Surface), nullptr);
+    UMaterialInstanceDynamic* Other = UMaterialInstanceDynamic::Create(UMaterial::GetDefaultMaterial(MD_Surface), nullptr);
+
+    // Slots are keyed by instance, name and type; acquiring one sets the initial value.
+    const int32 Fade = Batcher.AcquireParameter(Material, TEXT("Fade"), ENsTweenMaterialParameterType::Scalar, FLinearColor(0.25f, 0.f, 0.f, 0.f));
+    TestEqual(TEXT("Acquiring sets the initial value"), Material->K2_GetScalarParameterValue(TEXT("Fade")), 0.25f);
+    TestEqual(TEXT("Tweens on one parameter share a slot"), Batcher.AcquireParameter(Material, TEXT("Fade"), ENsTweenMaterialParameterType::Scalar, FLinearColor::Black), Fade);
+    const int32 Tint = Batcher.AcquireParameter(Material, TEXT("Fade"), ENsTweenMaterialParameterType::Vector, FLinearColor::Black);
+    TestNotEqual(TEXT("Scalar and vector parameters of one name are distinct"), Tint, Fade);
+    const int32 OtherFade = Batcher.AcquireParameter(Other, TEXT("Fade"), ENsTweenMaterialParameterType::Scalar, FLinearColor::Black);
+    TestNotEqual(TEXT("Parameters of other instances are distinct"), OtherFade, Fade);
+    TestEqual(TEXT("Parameters are grouped by instance"), Batcher.NumInstances(), 2);
+
+    Batcher.Write(Fade, FLinearColor(0.5f, 0.f, 0.f, 0.f));
+    Batcher.Write(Tint, FLinearColor(0.f, 0.5f, 0.f, 0.f));
+    Batcher.Write(OtherFade, FLinearColor(0.75f, 0.f, 0.f, 0.f));
+    Batcher.Flush();
+    TestEqual(TEXT("Each instance is written once"), Batcher.GetLastFlushCount(), 2);
+    TestEqual(TEXT("Scalar parameter is written by index"), Material->K2_GetScalarParameterValue(TEXT("Fade")), 0.5f, 1.e-4f);
+    TestEqual(TEXT("Vector parameter is written by index"), Material->K2_GetVectorParameterValue(TEXT("Fade")).G, 0.5f, 1.e-4f);
+    TestEqual(TEXT("Other instances are written"), Other->K2_GetScalarParameterValue(TEXT("Fade")), 0.75f, 1.e-4f);
+
+    // Clearing the instance's parameters invalidates the cached index; the name resolves it again.
+    Material->ClearParameterValues();
+    Batcher.Write(Fade, FLinearColor(1.f, 0.f, 0.f, 0.f));
+    Batcher.Flush();
+    TestEqual(TEXT("Stale indices are resolved again by name"), Material->K2_GetScalarParameterValue(TEXT("Fade")), 1.f, 1.e-4f);
+
+    Batcher.ReleaseParameter(OtherFade);
+    TestEqual(TEXT("Instances are dropped with their last parameter"), Batcher.NumInstances(), 1);
+
+    AddExpectedError(TEXT("Cannot tween material parameter"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestEqual(TEXT("Objects that are not material instances are rejected"), Batcher.AcquireParameter(GetTransientPackage(), TEXT("Fade"), ENsTweenMaterialParameterType::Scalar, FLinearColor::Black), static_cast<int32>(INDEX_NONE));
+    TestEqual(TEXT("Null objects are rejected"), Batcher.AcquireParameter(nullptr, TEXT("Fade"), ENsTweenMaterialParameterType::Scalar, FLinearColor::Black), static_cast<int32>(INDEX_NONE));
+    TestEqual(TEXT("Rejected objects hold no instance"), Batcher.NumInstances(), 1);
+
+    // Strategies join their parameter slot on the first write.
+    const FNsTweenSpec Spec;
+    FTweenValue_MaterialParameter Tween(Batcher, Material, TEXT("Glow"), ENsTweenMaterialParameterType::Scalar, FLinearColor::Black, FLinearColor(2.f, 0.f, 0.f, 0.f));
+    Tween.Prepare(Spec);
+    Tween.Initialize();
+    Tween.Apply(0.5f);
+    Batcher.Flush();
+    TestEqual(TEXT("Strategies write through their parameter slot"), Material->K2_GetScalarParameterValue(TEXT("Glow")), 1.f, 1.e-4f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
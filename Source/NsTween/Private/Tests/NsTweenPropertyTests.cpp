@@ -0,0 +1,58 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Components/SceneComponent.h"
+#include "Interfaces/ITweenValue.h"
+#include "Misc/AutomationTest.h"
+#include "Property/NsTweenPropertyPlan.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenPropertyTest, "NsTween.Property.PathStrategies", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenPropertyTest::RunTest(const FString& Parameters)
+{
+    USceneComponent* Component = NewObject<USceneComponent>();
+
+    // Whole struct, field by field.
+    const FVector StartLocation(0.0, 10.0, 20.0);
+    const FVector EndLocation(100.0, 10.0, -20.0);
+    TSharedPtr<ITweenValue> LocationTween = MakeNsTweenPropertyStrategy(Component, TEXT("RelativeLocation"), TBaseStructure<FVector>::Get(), &StartLocation, &EndLocation);
+    TestTrue(TEXT("Struct property resolves"), LocationTween.IsValid());
+    if (LocationTween)
+    {
+        LocationTween->Initialize();
+        TestEqual(TEXT("Initialize writes the start value"), Component->GetRelativeLocation(), StartLocation);
+        LocationTween->Apply(0.5f);
+        TestEqual(TEXT("Apply blends every field"), Component->GetRelativeLocation(), FVector(50.0, 10.0, 0.0));
+        LocationTween->ApplyFinal();
+        TestEqual(TEXT("ApplyFinal writes the end value"), Component->GetRelativeLocation(), EndLocation);
+    }
+
+    // Nested scalar field.
+    TSharedPtr<ITweenValue> HeightTween = MakeNsTweenPropertyStrategy(Component, TEXT("RelativeLocation.Z"), 0.0, 8.0);
+    TestTrue(TEXT("Nested scalar resolves"), HeightTween.IsValid());
+    if (HeightTween)
+    {
+        HeightTween->Apply(0.25f);
+        TestEqual(TEXT("Only the addressed field changes"), Component->GetRelativeLocation(), FVector(100.0, 10.0, 2.0));
+    }
+
+    // Rotators blend along the shortest path.
+    const FRotator StartRotation(0.0, 170.0, 0.0);
+    const FRotator EndRotation(0.0, -170.0, 0.0);
+    TSharedPtr<ITweenValue> RotationTween = MakeNsTweenPropertyStrategy(Component, TEXT("RelativeRotation"), TBaseStructure<FRotator>::Get(), &StartRotation, &EndRotation);
+    TestTrue(TEXT("Rotator property resolves"), RotationTween.IsValid());
+    if (RotationTween)
+    {
+        RotationTween->Apply(0.5f);
+        TestEqual(TEXT("Rotator takes the short way round"), FMath::Abs(FRotator::NormalizeAxis(Component->GetRelativeRotation().Yaw)), 180.0, 1.e-3);
+    }
+
+    AddExpectedError(TEXT("Cannot tween property"), EAutomationExpectedErrorFlags::Contains, 2);
+    TestFalse(TEXT("Unknown paths are rejected"), MakeNsTweenPropertyStrategy(Component, TEXT("NotAProperty"), 0.0, 1.0).IsValid());
+    TestFalse(TEXT("Type mismatches are rejected"), MakeNsTweenPropertyStrategy(Component, TEXT("RelativeLocation"), 0.0, 1.0).IsValid());
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
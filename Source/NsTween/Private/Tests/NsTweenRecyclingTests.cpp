@@ -0,0 +1,54 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Templates/NsTweenStrategyStorage.h"
+
+#if WITH_AUTOMATION_TESTS
+
+namespace NsTweenRecyclingTests
+{
+    /** Strategy too large for the inline buffer. */
+    template <int32 PayloadSize>
+    struct FSpilledStrategy : ITweenValue
+    {
+        explicit FSpilledStrategy(int32& InLiveCount) : LiveCount(InLiveCount) { ++LiveCount; }
+        virtual ~FSpilledStrategy() override { --LiveCount; }
+
+        virtual void Initialize() override {}
+        virtual void Apply(float EasedAlpha) override { Payload[0] = static_cast<uint8>(EasedAlpha); }
+
+        int32& LiveCount;
+        uint8 Payload[PayloadSize];
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenRecyclingTest, "NsTween.Recycling.SpilledStrategies", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenRecyclingTest::RunTest(const FString& Parameters)
+{
+    using namespace NsTweenRecyclingTests;
+    int32 LiveCount = 0;
+
+    FNsTweenStrategyStorage Storage;
+    ITweenValue* First = &Storage.Emplace<FSpilledStrategy<1024>>(LiveCount);
+    TestFalse(TEXT("Large strategies spill to the heap"), Storage.IsInline());
+    Storage.Reset();
+    TestEqual(TEXT("Reset destroys the strategy"), LiveCount, 0);
+    TestTrue(TEXT("Reset keeps the heap block"), Storage.GetHeapBlockSize() >= 1024);
+
+    ITweenValue* Second = &Storage.Emplace<FSpilledStrategy<1024>>(LiveCount);
+    TestTrue(TEXT("The next strategy of the same shape reuses the block"), First == Second);
+    Storage.Emplace<FSpilledStrategy<512>>(LiveCount);
+    TestEqual(TEXT("Smaller strategies reuse it too"), Storage.GetHeapAllocations(), 1);
+    Storage.Emplace<FSpilledStrategy<2048>>(LiveCount);
+    TestEqual(TEXT("Larger strategies grow it"), Storage.GetHeapAllocations(), 2);
+    TestEqual(TEXT("Every replaced strategy was destroyed"), LiveCount, 1);
+
+    Storage.Reset();
+    Storage.FreeHeapBlock();
+    TestEqual(TEXT("The block can be trimmed"), Storage.GetHeapBlockSize(), 0);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
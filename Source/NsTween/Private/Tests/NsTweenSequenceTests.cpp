@@ -0,0 +1,147 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Sequence/NsTweenCompiledSequence.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "ValueStrategies/TweenValue_Float.h"
+#include "ValueStrategies/TweenValue_Sequence.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenCompiledSequenceTest, "NsTween.Sequence.Compiled", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenCompiledSequenceTest::RunTest(const FString& Parameters)
+{
+    TArray<FNsTweenSequenceItem> Items;
+    Items.SetNum(3);
+    for (FNsTweenSequenceItem& Item : Items)
+    {
+        Item.Spec.DurationSeconds = 1.f;
+        Item.Spec.EasingPreset = ENsTweenEase::Linear;
+    }
+    Items[1].Spec.DelaySeconds = 0.5f;
+    Items[2].Track = 1;
+    Items[2].Spec.DurationSeconds = 4.f;
+
+    const TSharedRef<const FNsTweenCompiledSequence> Compiled = FNsTweenCompiledSequence::Compile(Items);
+    TestEqual(TEXT("Items on a track play back to back"), Compiled->GetSegment(1).StartTime, 1.5f);
+    TestEqual(TEXT("Tracks play in parallel"), Compiled->GetTracks().Num(), 2);
+    TestEqual(TEXT("Duration is the longest track"), Compiled->GetDuration(), 4.f);
+    TestEqual(TEXT("Nothing has started before time zero"), Compiled->FindSegment(0, -1.f), INDEX_NONE);
+    TestEqual(TEXT("Delay keeps the first item active"), Compiled->FindSegment(0, 1.25f), 0);
+    TestEqual(TEXT("Second item found by start offset"), Compiled->FindSegment(0, 2.f), 1);
+    TestEqual(TEXT("Segment alpha"), Compiled->EvaluateSegment(1, 2.f), 0.5f, 1.e-4f);
+
+    float Values[3] = { 0.f, 0.f, 0.f };
+    TArray<TSharedPtr<ITweenValue>> Bindings;
+    for (float& Value : Values)
+    {
+        Bindings.Add(MakeShared<FTweenValue_Float>(&Value, 0.f, 10.f));
+    }
+
+    FTweenValue_Sequence Player(Compiled, MoveTemp(Bindings));
+    Player.Initialize();
+    Player.Apply(0.5f);
+    TestEqual(TEXT("First item finished when the playhead passed it"), Values[0], 10.f);
+    TestEqual(TEXT("Second item mid-way"), Values[1], 5.f, 1.e-4f);
+    TestEqual(TEXT("Parallel track mid-way"), Values[2], 5.f, 1.e-4f);
+
+    Player.ApplyFinal();
+    TestEqual(TEXT("Every item ends on its final value"), Values[1] + Values[2], 20.f);
+
+    return true;
+}
+
+/** Float binding counting how often the sequence initializes it. */
+class FNsTweenCountingBinding final : public FTweenValue_Float
+{
+public:
+    using FTweenValue_Float::FTweenValue_Float;
+
+    virtual void Initialize() override
+    {
+        ++Initializations;
+        FTweenValue_Float::Initialize();
+    }
+
+    int32 Initializations = 0;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenCompiledSequencePingPongTest, "NsTween.Sequence.PingPong", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenCompiledSequencePingPongTest::RunTest(const FString& Parameters)
+{
+    TArray<FNsTweenSequenceItem> Items;
+    Items.SetNum(3);
+    for (FNsTweenSequenceItem& Item : Items)
+    {
+        Item.Spec.DurationSeconds = 1.f;
+        Item.Spec.EasingPreset = ENsTweenEase::Linear;
+    }
+
+    float Values[3] = { 0.f, 0.f, 0.f };
+    TArray<TSharedPtr<FNsTweenCountingBinding>> Counters;
+    TArray<TSharedPtr<ITweenValue>> Bindings;
+    for (float& Value : Values)
+    {
+        Counters.Add(MakeShared<FNsTweenCountingBinding>(&Value, 0.f, 10.f));
+        Bindings.Add(Counters.Last());
+    }
+
+    FTweenValue_Sequence Player(FNsTweenCompiledSequence::Compile(Items), MoveTemp(Bindings));
+    Player.Initialize();
+    Player.Apply(1.f);
+    TestEqual(TEXT("Forward pass ends every item"), Values[0] + Values[1] + Values[2], 30.f);
+
+    // The return leg of a ping-pong: only the segments the playhead crosses are rewound.
+    Player.Apply(0.5f);
+    TestEqual(TEXT("Segments behind the playhead keep their final value"), Values[0], 10.f);
+    TestEqual(TEXT("The active segment is evaluated on the way back"), Values[1], 5.f, 1.e-4f);
+    TestEqual(TEXT("Segments ahead of the playhead return to their start"), Values[2], 0.f);
+
+    Player.Apply(0.f);
+    TestEqual(TEXT("Playing back to the start rewinds every item"), Values[0] + Values[1] + Values[2], 0.f);
+
+    Player.Apply(1.f);
+    TestEqual(TEXT("The next forward pass ends every item again"), Values[0] + Values[1] + Values[2], 30.f);
+    for (const TSharedPtr<FNsTweenCountingBinding>& Counter : Counters)
+    {
+        TestEqual(TEXT("Bindings are initialized once"), Counter->Initializations, 1);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenCompiledSequenceBlobTest, "NsTween.Sequence.Blob", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenCompiledSequenceBlobTest::RunTest(const FString& Parameters)
+{
+    TArray<FNsTweenSequenceItem> Items;
+    Items.SetNum(2);
+    Items[0].Spec.DurationSeconds = 1.f;
+    Items[0].Spec.EasingPreset = ENsTweenEase::OutQuad;
+    Items[1].Spec.DurationSeconds = 2.f;
+    Items[1].Spec.EasingPreset = ENsTweenEase::CustomBezier;
+    Items[1].Spec.RotationMode = ENsTweenRotationMode::Nlerp;
+
+    const TSharedRef<FNsTweenCompiledSequence> Source = FNsTweenCompiledSequence::Compile(Items);
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    Source->Serialize(Writer);
+
+    FNsTweenCompiledSequence Loaded;
+    FMemoryReader Reader(Bytes);
+    Loaded.Serialize(Reader);
+
+    TestEqual(TEXT("Duration survives the round trip"), Loaded.GetDuration(), Source->GetDuration());
+    TestEqual(TEXT("Segments survive the round trip"), Loaded.GetSegment(1).StartTime, 1.f);
+    TestEqual(TEXT("Polynomial easing evaluates from its id"), Loaded.EvaluateSegment(0, 0.5f), Source->EvaluateSegment(0, 0.5f));
+    TestEqual(TEXT("Bezier easing evaluates from baked samples"), Loaded.EvaluateSegment(1, 2.f), Source->EvaluateSegment(1, 2.f));
+    TestEqual(TEXT("Binding spec keeps the interpolation modes"), Loaded.MakeBindingSpec(1).RotationMode, ENsTweenRotationMode::Nlerp);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
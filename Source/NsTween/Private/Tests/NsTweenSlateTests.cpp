@@ -0,0 +1,41 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Slate/NsTweenSlate.h"
+#include "Slate/NsTweenSlateRunner.h"
+#include "Widgets/Layout/SSpacer.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSlateTest, "NsTween.Slate.Runner", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSlateTest::RunTest(const FString& Parameters)
+{
+    const TSharedRef<SSpacer> Widget = SNew(SSpacer);
+
+    FNsTweenSpec Spec;
+    Spec.DurationSeconds = 1.f;
+
+    FNsTweenWidgetState Start;
+    FNsTweenWidgetState End;
+    End.Opacity = 0.f;
+
+    const FNsTweenHandle Handle = FNsTweenSlate::Play(Widget, ENsTweenWidgetChannel::Opacity, Start, End, Spec);
+    TestTrue(TEXT("Slate tween gets a handle"), Handle.IsValid());
+    TestTrue(TEXT("Slate tween runs until cancelled"), FNsTweenSlate::IsActive(Widget, Handle));
+
+    // Cancelling outside the active timer applies the final value immediately.
+    FNsTweenSlate::Cancel(Widget, Handle, true);
+    TestFalse(TEXT("Cancelled Slate tween is inactive"), FNsTweenSlate::IsActive(Widget, Handle));
+    TestEqual(TEXT("Final opacity applied on cancel"), Widget->GetRenderOpacity(), 0.f);
+
+    // A fresh runner must write its first value even when it equals the runner's defaults.
+    const TSharedRef<FNsTweenSlateRunner> Fresh = MakeShared<FNsTweenSlateRunner>(Widget);
+    Fresh->Write(ENsTweenWidgetChannel::Opacity, Start);
+    Fresh->CancelAll(false);
+    TestEqual(TEXT("First write of a new runner is applied"), Widget->GetRenderOpacity(), 1.f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
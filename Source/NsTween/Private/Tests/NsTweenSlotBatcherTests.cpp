@@ -0,0 +1,65 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenSlotBatcher.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSlotBatcherTest, "NsTween.Batching.SlotLifetime", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSlotBatcherTest::RunTest(const FString& Parameters)
+{
+    TNsTweenSlotBatcher<float, int32> Slots;
+    int32 Recycled = 0;
+    auto CountRecycled = [&Recycled](int32, float&) { ++Recycled; };
+
+    const int32 Slot = Slots.Add(7);
+    TestEqual(TEXT("Writers of one target share a slot"), Slots.AddReference(7), Slot);
+    TestEqual(TEXT("Unknown targets have no slot"), Slots.AddReference(8), static_cast<int32>(INDEX_NONE));
+
+    // A completing tween writes its final value and is released in the same tick.
+    Slots.MarkDirty(Slot) = 1.f;
+    Slots.Release(Slot, CountRecycled);
+    Slots.Release(Slot, CountRecycled);
+    TestEqual(TEXT("Slot survives release while a write is pending"), Slots.Num(), 1);
+
+    float Flushed = 0.f;
+    Slots.Flush([&Slots, &Flushed](TConstArrayView<int32> Written)
+    {
+        Flushed = Slots[Written[0]];
+        return Written.Num();
+    }, CountRecycled);
+    TestEqual(TEXT("Pending write is flushed after release"), Flushed, 1.f);
+    TestEqual(TEXT("Flush reports the targets it updated"), Slots.GetLastFlushCount(), 1);
+    TestEqual(TEXT("Released slots are recycled after the flush"), Slots.Num(), 0);
+    TestEqual(TEXT("Recycling is reported once"), Recycled, 1);
+    TestFalse(TEXT("Recycled slots are no longer valid"), Slots.IsValid(Slot));
+
+    // Writes and releases made from flush callbacks.
+    const int32 Kept = Slots.Add(1);
+    const int32 Dropped = Slots.Add(2);
+    Slots.MarkDirty(Kept);
+    Slots.MarkDirty(Dropped);
+    Slots.Flush([&Slots, Kept, Dropped, &CountRecycled](TConstArrayView<int32> Written)
+    {
+        Slots.MarkDirty(Kept);
+        Slots.Release(Dropped, CountRecycled);
+        Slots.Flush([](TConstArrayView<int32> Nested) { return Nested.Num(); });
+        return Written.Num();
+    }, CountRecycled);
+    TestEqual(TEXT("A slot released from a callback is recycled once"), Recycled, 2);
+    TestTrue(TEXT("Slots written from a callback stay alive"), Slots.IsValid(Kept));
+    TestEqual(TEXT("Flushes requested from a callback are ignored"), Slots.GetLastFlushCount(), 2);
+
+    int32 Deferred = 0;
+    Slots.Flush([&Deferred](TConstArrayView<int32> Written)
+    {
+        Deferred = Written.Num();
+        return Written.Num();
+    });
+    TestEqual(TEXT("Writes made from a callback are flushed next time"), Deferred, 1);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
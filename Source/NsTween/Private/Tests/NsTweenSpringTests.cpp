@@ -0,0 +1,71 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Spring/NsTweenSpring.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSpringSettleTest, "NsTween.Spring.Settle", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSpringSettleTest::RunTest(const FString& Parameters)
+{
+    FNsTweenSpringPool Pool;
+    FNsTweenSpringSpec Spec;
+    Spec.Frequency = 2.f;
+
+    double Value = 0.0;
+    const double Start = 0.0;
+    const FNsTweenSpringHandle Spring = Pool.Create(1, &Start, Spec, [&Value](const double* Channels) { Value = Channels[0]; });
+    TestEqual(TEXT("New springs sleep at their initial value"), Pool.NumAwake(), 0);
+
+    const double Target = 10.0;
+    TestTrue(TEXT("Setting the target wakes the spring"), Pool.SetTarget(Spring, 1, &Target) && Pool.NumAwake() == 1);
+    TestFalse(TEXT("Channel counts must match"), Pool.SetTarget(Spring, 3, &Target));
+
+    bool bMonotonic = true;
+    double Previous = Value;
+    for (int32 Frame = 0; Frame < 600 && Pool.NumAwake() > 0; ++Frame)
+    {
+        Pool.Tick(1.f / 60.f);
+        bMonotonic &= Value >= Previous && Value <= Target;
+        Previous = Value;
+    }
+    TestTrue(TEXT("Critically damped springs approach without overshoot"), bMonotonic);
+    TestEqual(TEXT("Settled springs sleep"), Pool.NumAwake(), 0);
+    TestEqual(TEXT("Settled springs snap onto their target"), Value, Target);
+
+    const double FarTarget = -50.0;
+    Pool.SetTarget(Spring, 1, &FarTarget);
+    Pool.Tick(10.f);
+    TestEqual(TEXT("Long frames stay stable"), Value, FarTarget, 1.e-3);
+
+    Pool.Release(Spring);
+    TestFalse(TEXT("Released handles go stale"), Pool.IsValid(Spring));
+    TestEqual(TEXT("Released springs leave the pool"), Pool.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSpringStepTest, "NsTween.Spring.Step", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSpringStepTest::RunTest(const FString& Parameters)
+{
+    // Two half steps must match one full step for every damping regime, since the step is the exact solution.
+    for (const float DampingRatio : { 0.3f, 1.f, 2.5f })
+    {
+        const FNsTweenSpringStep Full = FNsTweenSpringStep::Make(10.f, DampingRatio, 0.1f);
+        const FNsTweenSpringStep Half = FNsTweenSpringStep::Make(10.f, DampingRatio, 0.05f);
+
+        const double Offset = 1.0;
+        const double Velocity = -3.0;
+        const double HalfOffset = Half.PosPos * Offset + Half.PosVel * Velocity;
+        const double HalfVelocity = Half.VelPos * Offset + Half.VelVel * Velocity;
+
+        TestEqual(TEXT("Offset composes"), Half.PosPos * HalfOffset + Half.PosVel * HalfVelocity, Full.PosPos * Offset + Full.PosVel * Velocity, 1.e-6);
+        TestEqual(TEXT("Velocity composes"), Half.VelPos * HalfOffset + Half.VelVel * HalfVelocity, Full.VelPos * Offset + Full.VelVel * Velocity, 1.e-6);
+    }
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
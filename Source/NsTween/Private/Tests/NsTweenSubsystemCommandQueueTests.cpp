@@ -2,6 +2,7 @@
 
 #include "Interfaces/ITweenValue.h"
 #include "Misc/AutomationTest.h"
+#include "NsTween.h"
 #include "NsTweenSubsystem.h"
 #include "NsTweenTypeLibrary.h"
 
@@ -50,6 +51,116 @@ bool FNsTweenSubsystemCommandQueueTest::RunTest(const FString& Parameters)
     TestTrue(TEXT("Resume command is enqueued"), FNsTweenSubsystemTestAccessor::DequeueCommand(*Subsystem, Command));
     TestEqual(TEXT("Resume command type"), Command.Type, ENsTweenCommandType::Resume);
 
+    // Update commands
+    Subsystem->EnqueueSetTimeScale(SpawnHandle, 2.f);
+    TestTrue(TEXT("Time scale command is enqueued"), FNsTweenSubsystemTestAccessor::DequeueCommand(*Subsystem, Command));
+    TestEqual(TEXT("Time scale travels in the spec"), Command.Spec.TimeScale, 2.f);
+    TestFalse(TEXT("Other commands carry no end value"), Command.EndValue.IsValid());
+
+    Subsystem->EnqueueSetEndValue(SpawnHandle, FNsTweenValue(TInPlaceType<float>(), 5.f), /*bVelocityContinuous*/ true);
+    TestTrue(TEXT("End value command is enqueued"), FNsTweenSubsystemTestAccessor::DequeueCommand(*Subsystem, Command));
+    TestTrue(TEXT("End value travels out of line"), Command.EndValue.IsValid() && Command.EndValue->IsType<float>() && Command.EndValue->Get<float>() == 5.f);
+    TestTrue(TEXT("End value command keeps its velocity mode"), Command.bVelocityContinuous);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSubsystemReservedSpawnTest, "NsTween.Subsystem.ReservedSpawn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSubsystemReservedSpawnTest::RunTest(const FString& Parameters)
+{
+    UNsTweenSubsystem* Subsystem = NewObject<UNsTweenSubsystem>();
+    check(Subsystem);
+
+    FNsTweenColdData* Record = Subsystem->ReserveTween();
+    TestNotNull(TEXT("Reserve returns a record"), Record);
+    if (!Record)
+    {
+        return false;
+    }
+
+    const FNsTweenHandle ReservedHandle = Record->GetHandle();
+    TestTrue(TEXT("Reserved record has a valid handle"), ReservedHandle.IsValid());
+
+    Record->EmplaceStrategy<FAutomationTestTweenValue>();
+
+    FNsTweenSpec Spec;
+    const FNsTweenHandle SpawnHandle = Subsystem->EnqueueSpawn(ReservedHandle, MoveTemp(Spec));
+    TestEqual(TEXT("Spawn keeps the reserved handle"), SpawnHandle.Id.Value, ReservedHandle.Id.Value);
+    TestEqual(TEXT("Started record waits for the command pump"), FNsTweenSubsystemTestAccessor::NumPendingTweens(*Subsystem), 1);
+
+    FNsTweenCommand Command;
+    TestFalse(TEXT("Direct spawn bypasses the command queue"), FNsTweenSubsystemTestAccessor::DequeueCommand(*Subsystem, Command));
+
+    FNsTweenSpec SecondSpec;
+    const FNsTweenHandle SecondHandle = Subsystem->EnqueueSpawn(ReservedHandle, MoveTemp(SecondSpec));
+    TestFalse(TEXT("A reservation can only be spawned once"), SecondHandle.IsValid());
+
+    Subsystem->StopAllTweens(/*bApplyFinalOnCancel*/ false);
+    TestEqual(TEXT("Stopping releases pending records"), FNsTweenSubsystemTestAccessor::NumPendingTweens(*Subsystem), 0);
+
+    const FNsTweenMemoryStats Stats = Subsystem->GetMemoryStats();
+    TestTrue(TEXT("Hot record fits a cache line"), Stats.HotRecordBytes <= 64);
+    TestEqual(TEXT("Released record returns to the free list"), Stats.FreeRecords, Stats.ColdRecords);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSubsystemHandleLookupTest, "NsTween.Subsystem.HandleLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSubsystemHandleLookupTest::RunTest(const FString& Parameters)
+{
+    UNsTweenSubsystem* Subsystem = NewObject<UNsTweenSubsystem>();
+    check(Subsystem);
+
+    FNsTweenSpec Spec;
+    Spec.DurationSeconds = 1.f;
+    const FNsTweenHandle First = Subsystem->SpawnImmediate(FNsTweenSpec(Spec), MakeShared<FAutomationTestTweenValue>());
+    const FNsTweenHandle Second = Subsystem->SpawnImmediate(FNsTweenSpec(Spec), MakeShared<FAutomationTestTweenValue>());
+    TestTrue(TEXT("Live tweens are found by handle"), Subsystem->IsActive(First) && Subsystem->IsActive(Second));
+    TestFalse(TEXT("Unknown handles are not active"), Subsystem->IsActive(FNsTweenHandle()));
+
+    // Cancelling the first moves the second into its slot of the live pool.
+    Subsystem->EnqueueCancel(First, /*bApplyFinal*/ false);
+    FNsTweenSubsystemTestAccessor::ProcessCommands(*Subsystem);
+    TestFalse(TEXT("Cancelled tweens are no longer active"), Subsystem->IsActive(First));
+    TestTrue(TEXT("Moved tweens are still found"), Subsystem->IsActive(Second));
+    TestEqual(TEXT("Released records leave the lookup"), FNsTweenSubsystemTestAccessor::NumHandleRecords(*Subsystem), 1);
+
+    Subsystem->StopAllTweens(/*bApplyFinalOnCancel*/ false);
+    TestFalse(TEXT("Stopped tweens are no longer active"), Subsystem->IsActive(Second));
+    TestEqual(TEXT("Stopping empties the lookup"), FNsTweenSubsystemTestAccessor::NumHandleRecords(*Subsystem), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenSubsystemIdleSleepTest, "NsTween.Subsystem.IdleSleep", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenSubsystemIdleSleepTest::RunTest(const FString& Parameters)
+{
+    UNsTweenSubsystem* Subsystem = NewObject<UNsTweenSubsystem>();
+    check(Subsystem);
+
+    TestTrue(TEXT("A subsystem without tweens is idle"), FNsTweenSubsystemTestAccessor::IsIdle(*Subsystem));
+    TestFalse(TEXT("Nothing registers the ticker up front"), FNsTweenSubsystemTestAccessor::IsTickerAwake(*Subsystem));
+
+    const FNsTweenHandle Handle = Subsystem->EnqueueSpawn(FNsTweenSpec(), MakeShared<FAutomationTestTweenValue>());
+    TestFalse(TEXT("Queued work keeps the subsystem awake"), FNsTweenSubsystemTestAccessor::IsIdle(*Subsystem));
+    TestFalse(TEXT("Wakes before Initialize do not register a ticker"), FNsTweenSubsystemTestAccessor::IsTickerAwake(*Subsystem));
+
+    FNsTweenCommand Command;
+    FNsTweenSubsystemTestAccessor::DequeueCommand(*Subsystem, Command);
+    TestTrue(TEXT("A drained queue is idle again"), FNsTweenSubsystemTestAccessor::IsIdle(*Subsystem));
+    TestTrue(TEXT("Spawn still hands out a handle"), Handle.IsValid());
+
+    const FNsTweenClockHandle Clock = Subsystem->CreateClock(FNsTweenSpec());
+    TestFalse(TEXT("A running clock keeps the subsystem awake"), FNsTweenSubsystemTestAccessor::IsIdle(*Subsystem));
+    Subsystem->SetClockPaused(Clock, true);
+    TestTrue(TEXT("A paused clock lets it sleep"), FNsTweenSubsystemTestAccessor::IsIdle(*Subsystem));
+    Subsystem->SeekClock(Clock, 0.25f);
+    TestFalse(TEXT("A pending seek is published before sleeping"), FNsTweenSubsystemTestAccessor::IsIdle(*Subsystem));
+    Subsystem->ReleaseClock(Clock);
+
     return true;
 }
 
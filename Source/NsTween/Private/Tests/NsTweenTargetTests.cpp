@@ -0,0 +1,57 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Easing/NsTweenEasingFactory.h"
+#include "Misc/AutomationTest.h"
+#include "NsTween.h"
+#include "UObject/Package.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenTargetTest, "NsTween.Target.HandOver", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenTargetTest::RunTest(const FString& Parameters)
+{
+    FNsTweenTargetKey Position{FObjectKey(GetTransientPackage()), TEXT("Position")};
+    FNsTweenTargetKey Opacity{FObjectKey(GetTransientPackage()), TEXT("Opacity")};
+    TestTrue(TEXT("Object keys name a target"), Position.IsValid());
+    TestFalse(TEXT("Default keys do not"), FNsTweenTargetKey().IsValid());
+    TestTrue(TEXT("Channels of one object are distinct targets"), Position != Opacity);
+
+    float Value = 0.f;
+    auto StartTween = [&Value](FNsTweenColdData& Record, FNsTween& Tween, float From, float To)
+    {
+        FNsTweenSpec Spec;
+        Spec.DurationSeconds = 1.f;
+        Spec.EasingPreset = ENsTweenEase::Linear;
+
+        Record.EmplaceStrategy<FNsTweenCallbackValue<float>>(From, To, [&Value](const float& InValue) { Value = InValue; });
+        TSharedPtr<IEasingCurve> Easing = FNsTweenEasingFactory::Create(Spec);
+        Tween.Start(Record, MoveTemp(Spec), MoveTemp(Easing));
+    };
+
+    FNsTweenColdData OldRecord;
+    FNsTween Old;
+    StartTween(OldRecord, Old, 0.f, 10.f);
+    Old.Tick(0.4f);
+
+    FNsTweenColdData NewRecord;
+    FNsTween New;
+    StartTween(NewRecord, New, 0.f, 0.f);
+    TestTrue(TEXT("Callback tweens hand their value over"), Old.HandOverTo(New, Old.GetLinearAlpha()));
+    New.Tick(0.f);
+    TestEqual(TEXT("The new tween starts where the old one is"), Value, 4.f, 1.e-3f);
+    New.Tick(0.5f);
+    TestEqual(TEXT("And eases from there to its own end"), Value, 2.f, 1.e-3f);
+
+    FNsTweenColdData OtherRecord;
+    FNsTween Other;
+    OtherRecord.EmplaceStrategy<FNsTweenCallbackValue<FVector>>(FVector::ZeroVector, FVector::OneVector, [](const FVector&) {});
+    FNsTweenSpec OtherSpec;
+    TSharedPtr<IEasingCurve> OtherEasing = FNsTweenEasingFactory::Create(OtherSpec);
+    Other.Start(OtherRecord, MoveTemp(OtherSpec), MoveTemp(OtherEasing));
+    TestFalse(TEXT("Tweens of another type cannot take the value"), Old.HandOverTo(Other, Old.GetLinearAlpha()));
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenTransformBatcher.h"
+#include "Components/SceneComponent.h"
+#include "Misc/AutomationTest.h"
+#include "ValueStrategies/TweenValue_ComponentTransform.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenTransformBatcherTest, "NsTween.Batching.ComponentTransform", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenTransformBatcherTest::RunTest(const FString& Parameters)
+{
+    FNsTweenTransformBatcher Batcher;
+    USceneComponent* Component = NewObject<USceneComponent>();
+    const FNsTweenSpec Spec;
+
+    {
+        FTweenValue_ComponentTransform LocationTween(Batcher, Component, ENsTweenTransformChannel::Location, FTransform(FVector(0.0, 0.0, 0.0)), FTransform(FVector(100.0, 0.0, 0.0)), FNsTweenMoveOptions());
+        FTweenValue_ComponentTransform RotationTween(Batcher, Component, ENsTweenTransformChannel::Rotation, FTransform(FRotator(0.0, 0.0, 0.0)), FTransform(FRotator(0.0, 90.0, 0.0)), FNsTweenMoveOptions());
+        FTweenValue_ComponentTransform ScaleTween(Batcher, Component, ENsTweenTransformChannel::Scale, FTransform(FQuat::Identity, FVector::ZeroVector, FVector(1.0)), FTransform(FQuat::Identity, FVector::ZeroVector, FVector(3.0)), FNsTweenMoveOptions());
+        LocationTween.Prepare(Spec);
+        RotationTween.Prepare(Spec);
+        ScaleTween.Prepare(Spec);
+
+        LocationTween.Apply(0.5f);
+        RotationTween.Apply(0.5f);
+        ScaleTween.Apply(0.5f);
+        TestEqual(TEXT("Writes are deferred until the flush"), Component->GetRelativeLocation(), FVector::ZeroVector);
+        TestEqual(TEXT("Tweens on one component share a slot"), Batcher.Num(), 1);
+
+        Batcher.Flush();
+        TestEqual(TEXT("One move per component"), Batcher.GetLastFlushCount(), 1);
+        TestEqual(TEXT("Location is applied"), Component->GetRelativeLocation(), FVector(50.0, 0.0, 0.0), 1.e-3);
+        TestEqual(TEXT("Rotation is applied"), Component->GetRelativeRotation().Yaw, 45.0, 1.e-3);
+        TestEqual(TEXT("Scale is applied"), Component->GetRelativeScale3D(), FVector(2.0), 1.e-3);
+
+        // Completion writes the final value and releases the strategy in the same tick.
+        LocationTween.ApplyFinal();
+    }
+
+    TestEqual(TEXT("Slot survives release while a write is pending"), Batcher.Num(), 1);
+    Batcher.Flush();
+    TestEqual(TEXT("Final value is flushed after release"), Component->GetRelativeLocation(), FVector(100.0, 0.0, 0.0), 1.e-3);
+    TestEqual(TEXT("Released slots are recycled after the flush"), Batcher.Num(), 0);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
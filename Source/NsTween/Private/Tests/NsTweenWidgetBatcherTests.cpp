@@ -0,0 +1,64 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Batching/NsTweenWidgetBatcher.h"
+#include "Components/Image.h"
+#include "Misc/AutomationTest.h"
+#include "ValueStrategies/TweenValue_Widget.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenWidgetBatcherTest, "NsTween.Batching.Widget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenWidgetBatcherTest::RunTest(const FString& Parameters)
+{
+    FNsTweenWidgetBatcher Batcher;
+    UImage* Image = NewObject<UImage>();
+    const FNsTweenSpec Spec;
+
+    FNsTweenWidgetState Start;
+    FNsTweenWidgetState End;
+    End.Translation = FVector2D(100.0, 50.0);
+    End.Angle = 90.f;
+    End.Opacity = 0.f;
+    End.Color = FLinearColor::Red;
+
+    FTweenValue_Widget MoveTween(Batcher, Image, ENsTweenWidgetChannel::Translation | ENsTweenWidgetChannel::Angle, Start, End);
+    FTweenValue_Widget FadeTween(Batcher, Image, ENsTweenWidgetChannel::Opacity, Start, End);
+    FTweenValue_Widget TintTween(Batcher, Image, ENsTweenWidgetChannel::Color, Start, End);
+    MoveTween.Prepare(Spec);
+    FadeTween.Prepare(Spec);
+    TintTween.Prepare(Spec);
+
+    MoveTween.Apply(0.5f);
+    FadeTween.Apply(0.5f);
+    TintTween.Apply(0.5f);
+    TestEqual(TEXT("Tweens on one widget share a slot"), Batcher.Num(), 1);
+
+    Batcher.Flush();
+    TestEqual(TEXT("One update per widget"), Batcher.GetLastFlushCount(), 1);
+    TestEqual(TEXT("Translation is applied"), Image->GetRenderTransform().Translation, FVector2D(50.0, 25.0));
+    TestEqual(TEXT("Angle is applied"), Image->GetRenderTransform().Angle, 45.f, 1.e-4f);
+    TestEqual(TEXT("Opacity is applied"), Image->GetRenderOpacity(), 0.5f, 1.e-4f);
+    TestEqual(TEXT("Color is applied"), Image->GetColorAndOpacity().G, 0.5f, 1.e-4f);
+
+    // A paused or holding tween rewrites the same values; nothing should be invalidated.
+    MoveTween.Apply(0.5f);
+    FadeTween.Apply(0.5f);
+    TintTween.Apply(0.5f);
+    Batcher.Flush();
+    TestEqual(TEXT("Unchanged values do not invalidate"), Batcher.GetLastFlushCount(), 0);
+
+    // Values changed outside the batcher are written back even when the tween repeats itself.
+    Image->SetRenderOpacity(1.f);
+    Image->SetColorAndOpacity(FLinearColor::White);
+    FadeTween.Apply(0.5f);
+    TintTween.Apply(0.5f);
+    Batcher.Flush();
+    TestEqual(TEXT("External changes are overwritten"), Batcher.GetLastFlushCount(), 1);
+    TestEqual(TEXT("Opacity is restored"), Image->GetRenderOpacity(), 0.5f, 1.e-4f);
+    TestEqual(TEXT("Color is restored"), Image->GetColorAndOpacity().G, 0.5f, 1.e-4f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -1,7 +1,7 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "ValueStrategies/TweenValue_Color.h"
-#include "Math/UnrealMathUtility.h"
+#include "NsTweenTypeLibrary.h"
 
 FTweenValue_Color::FTweenValue_Color(FLinearColor* InTarget, const FLinearColor& InStart, const FLinearColor& InEnd)
     : Target(InTarget)
@@ -10,6 +10,11 @@ FTweenValue_Color::FTweenValue_Color(FLinearColor* InTarget, const FLinearColor&
 {
 }
 
+void FTweenValue_Color::Prepare(const FNsTweenSpec& Spec)
+{
+    Endpoints.Prepare(StartValue, EndValue, Spec.ColorMode);
+}
+
 void FTweenValue_Color::Initialize()
 {
     if (Target)
@@ -22,7 +27,7 @@ void FTweenValue_Color::Apply(float EasedAlpha)
 {
     if (Target)
     {
-        *Target = FMath::Lerp(StartValue, EndValue, EasedAlpha);
+        *Target = Endpoints.Evaluate(EasedAlpha);
     }
 }
 
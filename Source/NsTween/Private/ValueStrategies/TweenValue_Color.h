@@ -4,12 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenEndpoints.h"
 
 class FTweenValue_Color : public ITweenValue
 {
 public:
     FTweenValue_Color(FLinearColor* InTarget, const FLinearColor& InStart, const FLinearColor& InEnd);
 
+    virtual void Prepare(const FNsTweenSpec& Spec) override;
     virtual void Initialize() override;
     virtual void Apply(float EasedAlpha) override;
     virtual void ApplyFinal() override;
@@ -18,5 +20,6 @@ private:
     FLinearColor* Target = nullptr;
     FLinearColor StartValue = FLinearColor::Black;
     FLinearColor EndValue = FLinearColor::White;
+    FNsTweenColorEndpoints Endpoints;
 };
 
@@ -0,0 +1,78 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "ValueStrategies/TweenValue_ComponentTransform.h"
+#include "Components/SceneComponent.h"
+#include "Kernels/NsTweenKernels.h"
+#include "NsTweenTypeLibrary.h"
+
+FTweenValue_ComponentTransform::FTweenValue_ComponentTransform(FNsTweenTransformBatcher& InBatcher, USceneComponent* InComponent, ENsTweenTransformChannel InChannels, const FTransform& InStart, const FTransform& InEnd, const FNsTweenMoveOptions& InOptions)
+    : Batcher(&InBatcher)
+    , Component(InComponent)
+    , StartLocation(InStart.GetLocation())
+    , EndLocation(InEnd.GetLocation())
+    , StartScale(InStart.GetScale3D())
+    , EndScale(InEnd.GetScale3D())
+    , StartRotation(InStart.GetRotation())
+    , EndRotation(InEnd.GetRotation())
+    , Options(InOptions)
+    , Channels(InChannels)
+{
+}
+
+FTweenValue_ComponentTransform::~FTweenValue_ComponentTransform()
+{
+    if (Slot != INDEX_NONE)
+    {
+        // A layer stopped before its end takes its offset off the component on the next flush; baked layers keep theirs.
+        if (Options.bAdditive)
+        {
+            Batcher->ReleaseLayer(Slot, this);
+        }
+        Batcher->ReleaseSlot(Slot);
+    }
+}
+
+void FTweenValue_ComponentTransform::Prepare(const FNsTweenSpec& Spec)
+{
+    RotationEndpoints.Prepare(StartRotation, EndRotation, Spec.RotationMode);
+}
+
+void FTweenValue_ComponentTransform::Initialize()
+{
+    Write(StartLocation, StartRotation, StartScale);
+}
+
+void FTweenValue_ComponentTransform::Apply(float EasedAlpha)
+{
+    Write(
+        EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Location) ? FNsTweenKernels::LerpVector(StartLocation, EndLocation, EasedAlpha) : FVector::ZeroVector,
+        EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Rotation) ? RotationEndpoints.EvaluateQuat(EasedAlpha) : FQuat::Identity,
+        EnumHasAnyFlags(Channels, ENsTweenTransformChannel::Scale) ? FNsTweenKernels::LerpVector(StartScale, EndScale, EasedAlpha) : FVector::OneVector);
+}
+
+void FTweenValue_ComponentTransform::ApplyFinal()
+{
+    Write(EndLocation, EndRotation, EndScale, /*bFinal*/ true);
+}
+
+void FTweenValue_ComponentTransform::Write(const FVector& Location, const FQuat& Rotation, const FVector& Scale, bool bFinal)
+{
+    // Slots are joined lazily: strategies may be built off the game thread, but only ever apply on it.
+    if (Slot == INDEX_NONE)
+    {
+        Slot = Batcher->AcquireSlot(Component.Get(), Options.Space);
+        if (Slot == INDEX_NONE)
+        {
+            return;
+        }
+    }
+
+    if (Options.bAdditive)
+    {
+        const float Weight = Options.Weight;
+        Batcher->WriteAdditive(Slot, this, Channels, Location * Weight, FQuat::Slerp(FQuat::Identity, Rotation, Weight), Scale * Weight, bFinal, Options.bSweep, Options.bTeleport);
+        return;
+    }
+
+    Batcher->Write(Slot, Channels, Location, Rotation, Scale, Options.bSweep, Options.bTeleport);
+}
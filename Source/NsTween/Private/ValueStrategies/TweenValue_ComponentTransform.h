@@ -0,0 +1,43 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "Batching/NsTweenTransformBatcher.h"
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenEndpoints.h"
+
+class USceneComponent;
+
+/**
+ * Drives selected transform channels of a scene component through the subsystem's transform batcher. Additive tweens
+ * write weighted offsets that the batcher layers on the component's other tweens.
+ */
+class FTweenValue_ComponentTransform : public ITweenValue
+{
+public:
+    FTweenValue_ComponentTransform(FNsTweenTransformBatcher& InBatcher, USceneComponent* InComponent, ENsTweenTransformChannel InChannels, const FTransform& InStart, const FTransform& InEnd, const FNsTweenMoveOptions& InOptions);
+    virtual ~FTweenValue_ComponentTransform() override;
+
+    virtual void Prepare(const FNsTweenSpec& Spec) override;
+    virtual void Initialize() override;
+    virtual void Apply(float EasedAlpha) override;
+    virtual void ApplyFinal() override;
+
+private:
+    /** Hands the driven channels to the batcher, joining the component's slot on first use. */
+    void Write(const FVector& Location, const FQuat& Rotation, const FVector& Scale, bool bFinal = false);
+
+    FNsTweenTransformBatcher* Batcher = nullptr;
+    TWeakObjectPtr<USceneComponent> Component;
+    FVector StartLocation = FVector::ZeroVector;
+    FVector EndLocation = FVector::ZeroVector;
+    FVector StartScale = FVector::OneVector;
+    FVector EndScale = FVector::OneVector;
+    FQuat StartRotation = FQuat::Identity;
+    FQuat EndRotation = FQuat::Identity;
+    FNsTweenRotationEndpoints RotationEndpoints;
+    FNsTweenMoveOptions Options;
+    ENsTweenTransformChannel Channels = ENsTweenTransformChannel::None;
+    int32 Slot = INDEX_NONE;
+};
@@ -0,0 +1,150 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "ValueStrategies/TweenValue_InstanceSpan.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+FTweenValue_InstanceSpan::FTweenValue_InstanceSpan(FNsTweenInstanceBatcher& InBatcher, UInstancedStaticMeshComponent* InComponent, int32 InFirstInstance, int32 InNumInstances,
+    TConstArrayView<FTransform> StartTransforms, TConstArrayView<FTransform> EndTransforms,
+    int32 InCustomDataIndex, int32 InNumCustomData, TConstArrayView<float> StartCustomData, TConstArrayView<float> EndCustomData)
+    : Batcher(&InBatcher)
+    , Component(InComponent)
+    , FirstInstance(InFirstInstance)
+    , NumInstances(InNumInstances)
+    , CustomDataIndex(InCustomDataIndex)
+    , NumCustomData(InNumCustomData)
+{
+    if (StartTransforms.Num() == NumInstances && EndTransforms.Num() == NumInstances)
+    {
+        // Transposed once into channels so every tick runs the kernels over contiguous lanes.
+        TransformData.SetNumZeroed(3 * TransformChannels * NumInstances);
+        const TConstArrayView<FTransform> Sources[2] = { StartTransforms, EndTransforms };
+        for (int32 Block = 0; Block < 2; ++Block)
+        {
+            const FNsTweenTransformSoA View = MakeView(TransformData.GetData() + Block * TransformChannels * NumInstances);
+            for (int32 Index = 0; Index < NumInstances; ++Index)
+            {
+                const FVector Translation = Sources[Block][Index].GetTranslation();
+                const FQuat Rotation = Sources[Block][Index].GetRotation();
+                const FVector Scale = Sources[Block][Index].GetScale3D();
+                View.Translation.X[Index] = Translation.X;
+                View.Translation.Y[Index] = Translation.Y;
+                View.Translation.Z[Index] = Translation.Z;
+                View.Rotation.X[Index] = Rotation.X;
+                View.Rotation.Y[Index] = Rotation.Y;
+                View.Rotation.Z[Index] = Rotation.Z;
+                View.Rotation.W[Index] = Rotation.W;
+                View.Scale.X[Index] = Scale.X;
+                View.Scale.Y[Index] = Scale.Y;
+                View.Scale.Z[Index] = Scale.Z;
+            }
+        }
+    }
+
+    const int32 NumFloats = NumInstances * NumCustomData;
+    if (NumFloats > 0 && StartCustomData.Num() == NumFloats && EndCustomData.Num() == NumFloats)
+    {
+        CustomData.Reserve(2 * NumFloats);
+        CustomData.Append(StartCustomData.GetData(), NumFloats);
+        CustomData.Append(EndCustomData.GetData(), NumFloats);
+    }
+}
+
+FTweenValue_InstanceSpan::~FTweenValue_InstanceSpan()
+{
+    if (Slot != INDEX_NONE)
+    {
+        Batcher->ReleaseSlot(Slot);
+    }
+}
+
+void FTweenValue_InstanceSpan::Initialize()
+{
+    WriteEndpoint(false);
+}
+
+void FTweenValue_InstanceSpan::Apply(float EasedAlpha)
+{
+    if (!EnsureSlot())
+    {
+        return;
+    }
+
+    // Every instance shares the tween's alpha, so the uniform kernels splat it once per call.
+    if (TransformData.Num() > 0)
+    {
+        const int32 BlockSize = TransformChannels * NumInstances;
+        const FNsTweenTransformSoA Out = MakeView(TransformData.GetData() + 2 * BlockSize);
+        FNsTweenKernels::LerpTransformsUniform(MakeView(TransformData.GetData()), MakeView(TransformData.GetData() + BlockSize), EasedAlpha, Out, NumInstances);
+        WriteTransforms(Out);
+    }
+
+    if (CustomData.Num() > 0)
+    {
+        const int32 NumFloats = NumInstances * NumCustomData;
+        if (float* Dest = Batcher->WriteCustomData(Slot, FirstInstance, NumInstances, CustomDataIndex, NumCustomData))
+        {
+            FNsTweenKernels::LerpFloatsUniform(CustomData.GetData(), CustomData.GetData() + NumFloats, EasedAlpha, Dest, NumFloats);
+        }
+    }
+}
+
+void FTweenValue_InstanceSpan::ApplyFinal()
+{
+    WriteEndpoint(true);
+}
+
+FNsTweenTransformSoA FTweenValue_InstanceSpan::MakeView(double* Base) const
+{
+    FNsTweenTransformSoA View;
+    View.Translation = { Base, Base + NumInstances, Base + 2 * NumInstances };
+    View.Rotation = { Base + 3 * NumInstances, Base + 4 * NumInstances, Base + 5 * NumInstances, Base + 6 * NumInstances };
+    View.Scale = { Base + 7 * NumInstances, Base + 8 * NumInstances, Base + 9 * NumInstances };
+    return View;
+}
+
+void FTweenValue_InstanceSpan::WriteEndpoint(bool bEnd)
+{
+    if (!EnsureSlot())
+    {
+        return;
+    }
+
+    if (TransformData.Num() > 0)
+    {
+        WriteTransforms(MakeView(TransformData.GetData() + (bEnd ? TransformChannels * NumInstances : 0)));
+    }
+
+    if (CustomData.Num() > 0)
+    {
+        const int32 NumFloats = NumInstances * NumCustomData;
+        if (float* Dest = Batcher->WriteCustomData(Slot, FirstInstance, NumInstances, CustomDataIndex, NumCustomData))
+        {
+            FMemory::Memcpy(Dest, CustomData.GetData() + (bEnd ? NumFloats : 0), NumFloats * sizeof(float));
+        }
+    }
+}
+
+void FTweenValue_InstanceSpan::WriteTransforms(const FNsTweenTransformSoA& Source)
+{
+    if (FTransform* Dest = Batcher->WriteTransforms(Slot, FirstInstance, NumInstances))
+    {
+        for (int32 Index = 0; Index < NumInstances; ++Index)
+        {
+            Dest[Index] = FTransform(
+                FQuat(Source.Rotation.X[Index], Source.Rotation.Y[Index], Source.Rotation.Z[Index], Source.Rotation.W[Index]),
+                FVector(Source.Translation.X[Index], Source.Translation.Y[Index], Source.Translation.Z[Index]),
+                FVector(Source.Scale.X[Index], Source.Scale.Y[Index], Source.Scale.Z[Index]));
+        }
+    }
+}
+
+bool FTweenValue_InstanceSpan::EnsureSlot()
+{
+    // Slots are joined lazily: strategies may be built off the game thread, but only ever apply on it.
+    if (Slot == INDEX_NONE)
+    {
+        Slot = Batcher->AcquireSlot(Component.Get());
+    }
+
+    return Slot != INDEX_NONE;
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "Batching/NsTweenInstanceBatcher.h"
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenKernels.h"
+
+class UInstancedStaticMeshComponent;
+
+/**
+ * Drives the transforms and/or custom data floats of a contiguous span of instances through the subsystem's instance
+ * batcher. Endpoints are kept as structure-of-arrays channels and the whole span is interpolated by the batch kernels
+ * straight into the batcher's buffers.
+ */
+class FTweenValue_InstanceSpan : public ITweenValue
+{
+public:
+    /**
+     * StartTransforms/EndTransforms hold one transform per instance, or are empty to leave transforms alone.
+     * StartCustomData/EndCustomData hold NumCustomData floats per instance, or are empty to leave custom data alone.
+     */
+    FTweenValue_InstanceSpan(FNsTweenInstanceBatcher& InBatcher, UInstancedStaticMeshComponent* InComponent, int32 InFirstInstance, int32 InNumInstances,
+        TConstArrayView<FTransform> StartTransforms, TConstArrayView<FTransform> EndTransforms,
+        int32 InCustomDataIndex, int32 InNumCustomData, TConstArrayView<float> StartCustomData, TConstArrayView<float> EndCustomData);
+    virtual ~FTweenValue_InstanceSpan() override;
+
+    virtual void Initialize() override;
+    virtual void Apply(float EasedAlpha) override;
+    virtual void ApplyFinal() override;
+
+private:
+    /** Number of double channels of one SoA transform block. */
+    static constexpr int32 TransformChannels = 10;
+
+    /** Returns a SoA view over the transform block starting at Base. */
+    FNsTweenTransformSoA MakeView(double* Base) const;
+
+    /** Writes the start (false) or end (true) values without interpolating. */
+    void WriteEndpoint(bool bEnd);
+
+    /** Packs a SoA transform block into the batcher's buffer for the span. */
+    void WriteTransforms(const FNsTweenTransformSoA& Source);
+
+    /** Joins the component's slot on first use; returns false when the component cannot be driven. */
+    bool EnsureSlot();
+
+    FNsTweenInstanceBatcher* Batcher = nullptr;
+    TWeakObjectPtr<UInstancedStaticMeshComponent> Component;
+
+    /** Start, end and output transform blocks back to back, each TransformChannels * NumInstances doubles. */
+    TArray<double> TransformData;
+
+    /** Start then end custom data, NumInstances * NumCustomData floats each. */
+    TArray<float> CustomData;
+
+    int32 FirstInstance = 0;
+    int32 NumInstances = 0;
+    int32 CustomDataIndex = 0;
+    int32 NumCustomData = 0;
+    int32 Slot = INDEX_NONE;
+};
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "ValueStrategies/TweenValue_MaterialParameter.h"
+#include "NsTweenTypeLibrary.h"
+
+FTweenValue_MaterialParameter::FTweenValue_MaterialParameter(FNsTweenMaterialBatcher& InBatcher, UObject* InInstance, FName InParameterName, ENsTweenMaterialParameterType InType, const FLinearColor& InStart, const FLinearColor& InEnd)
+    : Batcher(&InBatcher)
+    , Instance(InInstance)
+    , ParameterName(InParameterName)
+    , StartValue(InStart)
+    , EndValue(InEnd)
+    , Type(InType)
+{
+}
+
+FTweenValue_MaterialParameter::~FTweenValue_MaterialParameter()
+{
+    if (Slot != INDEX_NONE)
+    {
+        Batcher->ReleaseParameter(Slot);
+    }
+}
+
+void FTweenValue_MaterialParameter::Prepare(const FNsTweenSpec& Spec)
+{
+    if (Type == ENsTweenMaterialParameterType::Vector)
+    {
+        Endpoints.Prepare(StartValue, EndValue, Spec.ColorMode);
+    }
+}
+
+void FTweenValue_MaterialParameter::Initialize()
+{
+    Write(StartValue);
+}
+
+void FTweenValue_MaterialParameter::Apply(float EasedAlpha)
+{
+    if (Type == ENsTweenMaterialParameterType::Scalar)
+    {
+        Write(FLinearColor(FMath::Lerp(StartValue.R, EndValue.R, EasedAlpha), 0.f, 0.f, 0.f));
+    }
+    else
+    {
+        Write(Endpoints.Evaluate(EasedAlpha));
+    }
+}
+
+void FTweenValue_MaterialParameter::ApplyFinal()
+{
+    Write(EndValue);
+}
+
+void FTweenValue_MaterialParameter::Write(const FLinearColor& Value)
+{
+    // Parameters are resolved lazily: strategies may be built off the game thread, but only ever apply on it.
+    if (Slot == INDEX_NONE)
+    {
+        Slot = Batcher->AcquireParameter(Instance.Get(), ParameterName, Type, Value);
+        if (Slot == INDEX_NONE)
+        {
+            return;
+        }
+    }
+
+    Batcher->Write(Slot, Value);
+}
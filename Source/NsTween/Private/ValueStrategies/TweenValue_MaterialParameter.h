@@ -0,0 +1,34 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "Batching/NsTweenMaterialBatcher.h"
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenEndpoints.h"
+
+/** Drives a scalar or vector parameter of a material instance through the subsystem's material batcher. */
+class FTweenValue_MaterialParameter : public ITweenValue
+{
+public:
+    FTweenValue_MaterialParameter(FNsTweenMaterialBatcher& InBatcher, UObject* InInstance, FName InParameterName, ENsTweenMaterialParameterType InType, const FLinearColor& InStart, const FLinearColor& InEnd);
+    virtual ~FTweenValue_MaterialParameter() override;
+
+    virtual void Prepare(const FNsTweenSpec& Spec) override;
+    virtual void Initialize() override;
+    virtual void Apply(float EasedAlpha) override;
+    virtual void ApplyFinal() override;
+
+private:
+    /** Hands the value to the batcher, resolving the parameter on first use. */
+    void Write(const FLinearColor& Value);
+
+    FNsTweenMaterialBatcher* Batcher = nullptr;
+    TWeakObjectPtr<UObject> Instance;
+    FName ParameterName;
+    FLinearColor StartValue = FLinearColor::Black;
+    FLinearColor EndValue = FLinearColor::Black;
+    FNsTweenColorEndpoints Endpoints;
+    ENsTweenMaterialParameterType Type = ENsTweenMaterialParameterType::Scalar;
+    int32 Slot = INDEX_NONE;
+};
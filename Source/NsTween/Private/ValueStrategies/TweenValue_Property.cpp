@@ -0,0 +1,41 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "ValueStrategies/TweenValue_Property.h"
+
+FTweenValue_Property::FTweenValue_Property(TSharedRef<FNsTweenPropertyOwner> InOwner, FNsTweenPropertyPlan&& InPlan)
+    : Owner(MoveTemp(InOwner))
+    , Plan(MoveTemp(InPlan))
+{
+    FMemory::Memzero(StartValue);
+    FMemory::Memzero(EndValue);
+}
+
+uint8* FTweenValue_Property::ResolveTarget() const
+{
+    UObject* Object = Owner->Get();
+    return Object ? reinterpret_cast<uint8*>(Object) + Plan.BaseOffset : nullptr;
+}
+
+void FTweenValue_Property::Initialize()
+{
+    if (uint8* Target = ResolveTarget())
+    {
+        Plan.Copy(StartValue, Target);
+    }
+}
+
+void FTweenValue_Property::Apply(float EasedAlpha)
+{
+    if (uint8* Target = ResolveTarget())
+    {
+        Plan.Blend(StartValue, EndValue, EasedAlpha, Target);
+    }
+}
+
+void FTweenValue_Property::ApplyFinal()
+{
+    if (uint8* Target = ResolveTarget())
+    {
+        Plan.Copy(EndValue, Target);
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Property/NsTweenPropertyPlan.h"
+
+class FTweenValue_Property : public ITweenValue
+{
+public:
+    FTweenValue_Property(TSharedRef<FNsTweenPropertyOwner> InOwner, FNsTweenPropertyPlan&& InPlan);
+
+    /** Resolved layout of the driven property. */
+    const FNsTweenPropertyPlan& GetPlan() const { return Plan; }
+
+    /** Start value buffer, laid out as the plan's leaf type. */
+    uint8* GetStartBuffer() { return StartValue; }
+
+    /** End value buffer, laid out as the plan's leaf type. */
+    uint8* GetEndBuffer() { return EndValue; }
+
+    virtual void Initialize() override;
+    virtual void Apply(float EasedAlpha) override;
+    virtual void ApplyFinal() override;
+
+private:
+    /** Returns the leaf inside the owner, or nullptr when the owner is gone. */
+    uint8* ResolveTarget() const;
+
+    TSharedRef<FNsTweenPropertyOwner> Owner;
+    FNsTweenPropertyPlan Plan;
+    alignas(16) uint8 StartValue[FNsTweenPropertyPlan::MaxValueSize];
+    alignas(16) uint8 EndValue[FNsTweenPropertyPlan::MaxValueSize];
+};
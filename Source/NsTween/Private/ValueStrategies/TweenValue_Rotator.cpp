@@ -1,21 +1,26 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "ValueStrategies/TweenValue_Rotator.h"
-#include "Math/Quat.h"
 #include "Math/UnrealMathUtility.h"
+#include "NsTweenTypeLibrary.h"
 
 FTweenValue_Rotator::FTweenValue_Rotator(FRotator* InTarget, const FRotator& InStart, const FRotator& InEnd)
     : Target(InTarget)
-    , StartQuat(InStart.Quaternion())
-    , EndQuat(InEnd.Quaternion())
+    , StartValue(InStart)
+    , EndValue(InEnd)
 {
 }
 
+void FTweenValue_Rotator::Prepare(const FNsTweenSpec& Spec)
+{
+    Endpoints.Prepare(StartValue, EndValue, Spec.RotationMode);
+}
+
 void FTweenValue_Rotator::Initialize()
 {
     if (Target)
     {
-        *Target = StartQuat.Rotator();
+        *Target = StartValue;
     }
 }
 
@@ -23,8 +28,7 @@ void FTweenValue_Rotator::Apply(float EasedAlpha)
 {
     if (Target)
     {
-        FQuat Result = FQuat::Slerp(StartQuat, EndQuat, EasedAlpha).GetNormalized();
-        *Target = Result.Rotator();
+        *Target = Endpoints.EvaluateRotator(EasedAlpha);
     }
 }
 
@@ -32,7 +36,7 @@ void FTweenValue_Rotator::ApplyFinal()
 {
     if (Target)
     {
-        *Target = EndQuat.Rotator();
+        *Target = EndValue;
     }
 }
 
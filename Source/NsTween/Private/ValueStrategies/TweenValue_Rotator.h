@@ -4,19 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenEndpoints.h"
 
 class FTweenValue_Rotator : public ITweenValue
 {
 public:
     FTweenValue_Rotator(FRotator* InTarget, const FRotator& InStart, const FRotator& InEnd);
 
+    virtual void Prepare(const FNsTweenSpec& Spec) override;
     virtual void Initialize() override;
     virtual void Apply(float EasedAlpha) override;
     virtual void ApplyFinal() override;
 
 private:
     FRotator* Target = nullptr;
-    FQuat StartQuat;
-    FQuat EndQuat;
+    FRotator StartValue = FRotator::ZeroRotator;
+    FRotator EndValue = FRotator::ZeroRotator;
+    FNsTweenRotationEndpoints Endpoints;
 };
 
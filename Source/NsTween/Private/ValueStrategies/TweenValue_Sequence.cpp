@@ -0,0 +1,127 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "ValueStrategies/TweenValue_Sequence.h"
+#include "Sequence/NsTweenCompiledSequence.h"
+
+FTweenValue_Sequence::FTweenValue_Sequence(TSharedRef<const FNsTweenCompiledSequence> InSequence, TArray<TSharedPtr<ITweenValue>> InBindings)
+    : Sequence(MoveTemp(InSequence))
+    , Bindings(MoveTemp(InBindings))
+{
+    Cursors.SetNum(Sequence->GetTracks().Num());
+
+    int32 NumSegments = 0;
+    for (const FNsTweenSequenceTrack& Track : Sequence->GetTracks())
+    {
+        NumSegments = FMath::Max(NumSegments, Track.FirstSegment + Track.NumSegments);
+    }
+    EnteredSegments.Init(false, NumSegments);
+}
+
+void FTweenValue_Sequence::Initialize()
+{
+    for (FTrackCursor& Cursor : Cursors)
+    {
+        Cursor = FTrackCursor();
+    }
+    EnteredSegments.SetRange(0, EnteredSegments.Num(), false);
+    Playhead = 0.f;
+    Seek(0.f);
+}
+
+void FTweenValue_Sequence::Apply(float EasedAlpha)
+{
+    Seek(EasedAlpha * Sequence->GetDuration());
+}
+
+void FTweenValue_Sequence::ApplyFinal()
+{
+    Seek(Sequence->GetDuration());
+}
+
+void FTweenValue_Sequence::Seek(float Time)
+{
+    const bool bBackward = Time < Playhead;
+    Playhead = Time;
+
+    for (int32 TrackIndex = 0; TrackIndex < Cursors.Num(); ++TrackIndex)
+    {
+        FTrackCursor& Cursor = Cursors[TrackIndex];
+        const int32 Target = Sequence->FindSegment(TrackIndex, Time);
+
+        // Step back over the segments the playhead left, returning each to its start; only the crossed ones are touched.
+        if (bBackward)
+        {
+            const int32 FirstSegment = Sequence->GetTracks()[TrackIndex].FirstSegment;
+            while (Cursor.Segment != INDEX_NONE && Cursor.Segment > Target)
+            {
+                if (ITweenValue* Binding = GetBinding(Cursor.Segment))
+                {
+                    Binding->Apply(Sequence->EvaluateSegment(Cursor.Segment, Sequence->GetSegment(Cursor.Segment).StartTime));
+                }
+                Cursor.Segment = Cursor.Segment == FirstSegment ? INDEX_NONE : Cursor.Segment - 1;
+            }
+            Cursor.bFinished = false;
+        }
+
+        if (Target == INDEX_NONE)
+        {
+            continue;
+        }
+
+        // Finish the segment being left and run through any the frame skipped entirely.
+        while (Cursor.Segment < Target)
+        {
+            if (Cursor.Segment != INDEX_NONE && !Cursor.bFinished)
+            {
+                if (ITweenValue* Binding = GetBinding(Cursor.Segment))
+                {
+                    Binding->ApplyFinal();
+                }
+            }
+
+            Cursor.Segment = Cursor.Segment == INDEX_NONE ? Sequence->GetTracks()[TrackIndex].FirstSegment : Cursor.Segment + 1;
+            Cursor.bFinished = false;
+            EnterSegment(Cursor.Segment);
+        }
+
+        if (Cursor.bFinished)
+        {
+            continue;
+        }
+
+        ITweenValue* Binding = GetBinding(Cursor.Segment);
+        if (Time >= Sequence->GetSegment(Cursor.Segment).EndTime)
+        {
+            if (Binding)
+            {
+                Binding->ApplyFinal();
+            }
+            Cursor.bFinished = true;
+        }
+        else if (Binding)
+        {
+            Binding->Apply(Sequence->EvaluateSegment(Cursor.Segment, Time));
+        }
+    }
+}
+
+void FTweenValue_Sequence::EnterSegment(int32 SegmentIndex)
+{
+    // Re-entering after a backward step keeps the values captured the first time.
+    if (EnteredSegments[SegmentIndex])
+    {
+        return;
+    }
+
+    EnteredSegments[SegmentIndex] = true;
+    if (ITweenValue* Binding = GetBinding(SegmentIndex))
+    {
+        Binding->Initialize();
+    }
+}
+
+ITweenValue* FTweenValue_Sequence::GetBinding(int32 SegmentIndex) const
+{
+    const int32 Item = Sequence->GetSegment(SegmentIndex).Item;
+    return Bindings.IsValidIndex(Item) ? Bindings[Item].Get() : nullptr;
+}
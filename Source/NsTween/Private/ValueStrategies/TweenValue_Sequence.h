@@ -0,0 +1,55 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+
+class FNsTweenCompiledSequence;
+
+/**
+ * Plays a compiled sequence as one tween: the tween's linear alpha is the playhead, and each track looks up its
+ * active segment by binary search and drives that item's binding. Segments skipped by a long frame are still
+ * initialized and finished in order, so every binding ends on its final value. Playing backward (ping-pong, backward
+ * direction or a loop restart) steps each cursor back over the segments it leaves, returning each to its start value;
+ * bindings are initialized once, the first time their segment is reached.
+ */
+class FTweenValue_Sequence : public ITweenValue
+{
+public:
+    FTweenValue_Sequence(TSharedRef<const FNsTweenCompiledSequence> InSequence, TArray<TSharedPtr<ITweenValue>> InBindings);
+
+    virtual void Initialize() override;
+    virtual void Apply(float EasedAlpha) override;
+    virtual void ApplyFinal() override;
+
+private:
+    /** Playback position of one track. */
+    struct FTrackCursor
+    {
+        /** Segment being played, INDEX_NONE before the first one starts. */
+        int32 Segment = INDEX_NONE;
+
+        /** Set once the current segment applied its final value. */
+        bool bFinished = false;
+    };
+
+    /** Moves every track to sequence time Time. */
+    void Seek(float Time);
+
+    /** Initializes a segment's binding the first time the playhead reaches it. */
+    void EnterSegment(int32 SegmentIndex);
+
+    /** Returns the binding of a segment, or nullptr for unbound items. */
+    ITweenValue* GetBinding(int32 SegmentIndex) const;
+
+private:
+    TSharedRef<const FNsTweenCompiledSequence> Sequence;
+    TArray<TSharedPtr<ITweenValue>> Bindings;
+    TArray<FTrackCursor, TInlineAllocator<4>> Cursors;
+
+    /** Segments whose binding was initialized since the sequence started. */
+    TBitArray<> EnteredSegments;
+
+    float Playhead = 0.f;
+};
@@ -0,0 +1,28 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Slate/NsTweenSlateRunner.h"
+#include "ValueStrategies/TweenValue_Widget.h"
+
+/** Drives selected channels of a Slate widget through the widget's runner. */
+class FTweenValue_SlateWidget : public FTweenValue_WidgetState
+{
+public:
+    FTweenValue_SlateWidget(FNsTweenSlateRunner& InRunner, ENsTweenWidgetChannel InChannels, const FNsTweenWidgetState& InStart, const FNsTweenWidgetState& InEnd)
+        : FTweenValue_WidgetState(InChannels, InStart, InEnd)
+        , Runner(&InRunner)
+    {
+    }
+
+protected:
+    virtual void Write(const FNsTweenWidgetState& State) override
+    {
+        Runner->Write(Channels, State);
+    }
+
+private:
+    /** Runner owning the tween; it outlives its tweens' strategies. */
+    FNsTweenSlateRunner* Runner = nullptr;
+};
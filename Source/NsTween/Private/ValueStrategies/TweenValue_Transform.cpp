@@ -1,8 +1,8 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "ValueStrategies/TweenValue_Transform.h"
-#include "Math/Quat.h"
-#include "Math/UnrealMathUtility.h"
+#include "Kernels/NsTweenKernels.h"
+#include "NsTweenTypeLibrary.h"
 
 FTweenValue_Transform::FTweenValue_Transform(FTransform* InTarget, const FTransform& InStart, const FTransform& InEnd)
     : Target(InTarget)
@@ -11,6 +11,11 @@ FTweenValue_Transform::FTweenValue_Transform(FTransform* InTarget, const FTransf
 {
 }
 
+void FTweenValue_Transform::Prepare(const FNsTweenSpec& Spec)
+{
+    RotationEndpoints.Prepare(StartValue.GetRotation(), EndValue.GetRotation(), Spec.RotationMode);
+}
+
 void FTweenValue_Transform::Initialize()
 {
     if (Target)
@@ -21,18 +26,13 @@ void FTweenValue_Transform::Initialize()
 
 void FTweenValue_Transform::Apply(float EasedAlpha)
 {
-    if (!Target)
+    if (Target)
     {
-        return;
+        *Target = FTransform(
+            RotationEndpoints.EvaluateQuat(EasedAlpha),
+            FNsTweenKernels::LerpVector(StartValue.GetTranslation(), EndValue.GetTranslation(), EasedAlpha),
+            FNsTweenKernels::LerpVector(StartValue.GetScale3D(), EndValue.GetScale3D(), EasedAlpha));
     }
-
-    const FVector Location = FMath::Lerp(StartValue.GetLocation(), EndValue.GetLocation(), EasedAlpha);
-    const FVector Scale = FMath::Lerp(StartValue.GetScale3D(), EndValue.GetScale3D(), EasedAlpha);
-    const FQuat Rotation = FQuat::Slerp(StartValue.GetRotation(), EndValue.GetRotation(), EasedAlpha).GetNormalized();
-
-    Target->SetLocation(Location);
-    Target->SetRotation(Rotation);
-    Target->SetScale3D(Scale);
 }
 
 void FTweenValue_Transform::ApplyFinal()
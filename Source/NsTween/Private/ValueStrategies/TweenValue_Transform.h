@@ -4,12 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenEndpoints.h"
 
 class FTweenValue_Transform : public ITweenValue
 {
 public:
     FTweenValue_Transform(FTransform* InTarget, const FTransform& InStart, const FTransform& InEnd);
 
+    virtual void Prepare(const FNsTweenSpec& Spec) override;
     virtual void Initialize() override;
     virtual void Apply(float EasedAlpha) override;
     virtual void ApplyFinal() override;
@@ -18,5 +20,6 @@ private:
     FTransform* Target = nullptr;
     FTransform StartValue;
     FTransform EndValue;
+    FNsTweenRotationEndpoints RotationEndpoints;
 };
 
@@ -1,6 +1,7 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "ValueStrategies/TweenValue_Vector.h"
+#include "Kernels/NsTweenKernels.h"
 #include "Math/UnrealMathUtility.h"
 
 FTweenValue_Vector::FTweenValue_Vector(FVector* InTarget, const FVector& InStart, const FVector& InEnd)
@@ -22,7 +23,7 @@ void FTweenValue_Vector::Apply(float EasedAlpha)
 {
     if (Target)
     {
-        *Target = FMath::Lerp(StartValue, EndValue, EasedAlpha);
+        *Target = FNsTweenKernels::LerpVector(StartValue, EndValue, EasedAlpha);
     }
 }
 
@@ -0,0 +1,92 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "ValueStrategies/TweenValue_Widget.h"
+#include "Components/Widget.h"
+#include "NsTweenTypeLibrary.h"
+
+FTweenValue_WidgetState::FTweenValue_WidgetState(ENsTweenWidgetChannel InChannels, const FNsTweenWidgetState& InStart, const FNsTweenWidgetState& InEnd)
+    : Channels(InChannels)
+    , StartValue(InStart)
+    , EndValue(InEnd)
+{
+}
+
+void FTweenValue_WidgetState::Prepare(const FNsTweenSpec& Spec)
+{
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Color))
+    {
+        ColorEndpoints.Prepare(StartValue.Color, EndValue.Color, Spec.ColorMode);
+    }
+}
+
+void FTweenValue_WidgetState::Initialize()
+{
+    Write(StartValue);
+}
+
+void FTweenValue_WidgetState::Apply(float EasedAlpha)
+{
+    // Only the driven channels are read by the sink, so the rest are left at their defaults.
+    FNsTweenWidgetState State;
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Translation))
+    {
+        State.Translation = FMath::Lerp(StartValue.Translation, EndValue.Translation, static_cast<double>(EasedAlpha));
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Scale))
+    {
+        State.Scale = FMath::Lerp(StartValue.Scale, EndValue.Scale, static_cast<double>(EasedAlpha));
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Shear))
+    {
+        State.Shear = FMath::Lerp(StartValue.Shear, EndValue.Shear, static_cast<double>(EasedAlpha));
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Angle))
+    {
+        State.Angle = FMath::Lerp(StartValue.Angle, EndValue.Angle, EasedAlpha);
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Opacity))
+    {
+        State.Opacity = FMath::Lerp(StartValue.Opacity, EndValue.Opacity, EasedAlpha);
+    }
+    if (EnumHasAnyFlags(Channels, ENsTweenWidgetChannel::Color))
+    {
+        State.Color = ColorEndpoints.Evaluate(EasedAlpha);
+    }
+
+    Write(State);
+}
+
+void FTweenValue_WidgetState::ApplyFinal()
+{
+    Write(EndValue);
+}
+
+FTweenValue_Widget::FTweenValue_Widget(FNsTweenWidgetBatcher& InBatcher, UWidget* InWidget, ENsTweenWidgetChannel InChannels, const FNsTweenWidgetState& InStart, const FNsTweenWidgetState& InEnd)
+    : FTweenValue_WidgetState(InChannels, InStart, InEnd)
+    , Batcher(&InBatcher)
+    , Widget(InWidget)
+{
+}
+
+FTweenValue_Widget::~FTweenValue_Widget()
+{
+    if (Slot != INDEX_NONE)
+    {
+        Batcher->ReleaseSlot(Slot);
+    }
+}
+
+void FTweenValue_Widget::Write(const FNsTweenWidgetState& State)
+{
+    // Slots are joined lazily: strategies may be built off the game thread, but only ever apply on it.
+    if (Slot == INDEX_NONE)
+    {
+        Slot = Batcher->AcquireSlot(Widget.Get());
+        if (Slot == INDEX_NONE)
+        {
+            return;
+        }
+    }
+
+    Batcher->Write(Slot, Channels, State);
+}
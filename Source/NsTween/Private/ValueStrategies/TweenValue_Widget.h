@@ -0,0 +1,48 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "Batching/NsTweenWidgetBatcher.h"
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Kernels/NsTweenEndpoints.h"
+
+/** Interpolates the selected widget channels and hands the result to the sink implemented by subclasses. */
+class FTweenValue_WidgetState : public ITweenValue
+{
+public:
+    FTweenValue_WidgetState(ENsTweenWidgetChannel InChannels, const FNsTweenWidgetState& InStart, const FNsTweenWidgetState& InEnd);
+
+    virtual void Prepare(const FNsTweenSpec& Spec) override;
+    virtual void Initialize() override;
+    virtual void Apply(float EasedAlpha) override;
+    virtual void ApplyFinal() override;
+
+protected:
+    /** Receives the interpolated state; only the driven channels are meaningful. */
+    virtual void Write(const FNsTweenWidgetState& State) = 0;
+
+    ENsTweenWidgetChannel Channels = ENsTweenWidgetChannel::None;
+
+private:
+    FNsTweenWidgetState StartValue;
+    FNsTweenWidgetState EndValue;
+    FNsTweenColorEndpoints ColorEndpoints;
+};
+
+/** Drives selected render transform, opacity and color channels of a UMG widget through the subsystem's widget batcher. */
+class FTweenValue_Widget : public FTweenValue_WidgetState
+{
+public:
+    FTweenValue_Widget(FNsTweenWidgetBatcher& InBatcher, UWidget* InWidget, ENsTweenWidgetChannel InChannels, const FNsTweenWidgetState& InStart, const FNsTweenWidgetState& InEnd);
+    virtual ~FTweenValue_Widget() override;
+
+protected:
+    /** Hands the driven channels to the batcher, joining the widget's slot on first use. */
+    virtual void Write(const FNsTweenWidgetState& State) override;
+
+private:
+    FNsTweenWidgetBatcher* Batcher = nullptr;
+    TWeakObjectPtr<UWidget> Widget;
+    int32 Slot = INDEX_NONE;
+};
@@ -0,0 +1,102 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Batching/NsTweenSlotBatcher.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UInstancedStaticMeshComponent;
+
+/**
+ * Collects the per-instance writes of every instanced static mesh tween during a tick and submits them once per
+ * component. Transform spans are merged into one contiguous BatchUpdateInstancesTransforms call, custom data floats
+ * are written without dirtying the render state, and each written component is marked render-state dirty once.
+ * Works for ISM and HISM components; transforms are in component space. Game thread only.
+ */
+class NSTWEEN_API FNsTweenInstanceBatcher
+{
+public:
+    /** Returns the slot gathering writes for a component, adding a reference to it. */
+    int32 AcquireSlot(UInstancedStaticMeshComponent* Component);
+
+    /** Drops a reference taken by AcquireSlot; the slot is recycled once its pending writes are flushed. */
+    void ReleaseSlot(int32 SlotIndex);
+
+    /**
+     * Returns storage for the transforms of Count instances starting at FirstInstance, submitted on the next flush.
+     * The storage is only valid until the next write to the slot.
+     */
+    FTransform* WriteTransforms(int32 SlotIndex, int32 FirstInstance, int32 Count);
+
+    /**
+     * Returns storage for NumCustomData custom data floats per instance, starting at CustomDataIndex, for Count
+     * instances starting at FirstInstance, laid out instance by instance. Valid until the next write to the slot.
+     */
+    float* WriteCustomData(int32 SlotIndex, int32 FirstInstance, int32 Count, int32 CustomDataIndex, int32 NumCustomData);
+
+    /** Submits every component with pending writes once. */
+    void Flush();
+
+    /** Drops all slots and pending writes. */
+    void Empty();
+
+    /** Number of components that have live tweens. */
+    int32 Num() const { return Slots.Num(); }
+
+    /** Number of components submitted by the last flush. */
+    int32 GetLastFlushCount() const { return Slots.GetLastFlushCount(); }
+
+private:
+    /** Range of instances written by one tween, and where its values start in the slot's buffer. */
+    struct FSpan
+    {
+        /** First instance written. */
+        int32 FirstInstance = 0;
+
+        /** Number of instances written. */
+        int32 Count = 0;
+
+        /** First value of the span in the slot's transform or custom data buffer. */
+        int32 Offset = 0;
+
+        /** First custom data float written per instance; unused for transforms. */
+        int32 CustomDataIndex = 0;
+
+        /** Custom data floats written per instance; unused for transforms. */
+        int32 NumCustomData = 0;
+    };
+
+    /** Pending writes of one component. */
+    struct FSlot
+    {
+        /** Component submitted on flush. */
+        TWeakObjectPtr<UInstancedStaticMeshComponent> Component;
+
+        /** Transform spans written since the last flush, in write order. */
+        TArray<FSpan> TransformSpans;
+
+        /** Transforms of every span, back to back. */
+        TArray<FTransform> Transforms;
+
+        /** Custom data spans written since the last flush, in write order. */
+        TArray<FSpan> CustomDataSpans;
+
+        /** Custom data floats of every span, back to back. */
+        TArray<float> CustomData;
+    };
+
+    /** Submits the pending writes of a slot; returns true when the component was updated. */
+    bool SubmitSlot(UInstancedStaticMeshComponent& Component, FSlot& Slot);
+
+private:
+    /** Pending writes by component. */
+    TNsTweenSlotBatcher<FSlot, FObjectKey> Slots;
+
+    /** Scratch range submitted when a component has several transform spans. */
+    TArray<FTransform> MergedTransforms;
+
+    /** Scratch coverage of MergedTransforms by the pending spans. */
+    TBitArray<> MergedCoverage;
+};
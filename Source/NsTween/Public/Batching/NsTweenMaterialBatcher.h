@@ -0,0 +1,119 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Batching/NsTweenSlotBatcher.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UMaterialInstanceDynamic;
+
+/** Type of a tweened material parameter. */
+enum class ENsTweenMaterialParameterType : uint8
+{
+    /** Scalar parameter; the value travels in the red channel. */
+    Scalar,
+    /** Vector parameter. */
+    Vector,
+};
+
+/**
+ * Collects material parameter writes of every material tween during a tick and applies them grouped by instance.
+ * Dynamic material instance parameters are resolved to their parameter index once, when the first tween on them
+ * starts, and written by index afterwards. Parameter collection instances have no indexed setters, so their
+ * parameters are validated once and only the latest value of each parameter is written per flush.
+ * Game thread only.
+ */
+class NSTWEEN_API FNsTweenMaterialBatcher
+{
+public:
+    /**
+     * Returns the slot gathering writes for one parameter of a UMaterialInstanceDynamic or
+     * UMaterialParameterCollectionInstance, adding a reference to it. The parameter is set to InitialValue when the
+     * slot is created. Returns INDEX_NONE when the object or parameter cannot be driven.
+     */
+    int32 AcquireParameter(UObject* Instance, FName ParameterName, ENsTweenMaterialParameterType Type, const FLinearColor& InitialValue);
+
+    /** Drops a reference taken by AcquireParameter; the slot is recycled once its pending write is flushed. */
+    void ReleaseParameter(int32 ParameterSlot);
+
+    /** Records the value written on the next flush. */
+    void Write(int32 ParameterSlot, const FLinearColor& Value);
+
+    /** Writes every pending parameter, one instance at a time. */
+    void Flush();
+
+    /** Drops all slots and pending writes. */
+    void Empty();
+
+    /** Number of material instances that have live tweens. */
+    int32 NumInstances() const { return Instances.Num() - FreeInstances.Num(); }
+
+    /** Number of instances written by the last flush. */
+    int32 GetLastFlushCount() const { return Parameters.GetLastFlushCount(); }
+
+private:
+    /** Pending value of one parameter. */
+    struct FParameter
+    {
+        /** Parameter name, kept to re-resolve the index if the instance's parameters were cleared. */
+        FName Name;
+
+        /** Pending value. */
+        FLinearColor Value = FLinearColor::Black;
+
+        /** Owning entry in Instances. */
+        int32 Instance = INDEX_NONE;
+
+        /** Index in the dynamic instance's parameter array; unused for collections. */
+        int32 ParameterIndex = INDEX_NONE;
+
+        /** Scalar or vector. */
+        ENsTweenMaterialParameterType Type = ENsTweenMaterialParameterType::Scalar;
+    };
+
+    /** Material instance whose parameters are driven. */
+    struct FInstance
+    {
+        /** Dynamic material instance or parameter collection instance. */
+        TWeakObjectPtr<UObject> Object;
+
+        /** Lookup key of the object, kept for removal after it is destroyed. */
+        FObjectKey Key;
+
+        /** Written parameter slots, gathered while flushing. */
+        TArray<int32, TInlineAllocator<4>> DirtyParameters;
+
+        /** Parameter slots referencing the instance. */
+        int32 NumParameters = 0;
+
+        /** True for UMaterialParameterCollectionInstance, false for UMaterialInstanceDynamic. */
+        bool bCollection = false;
+    };
+
+    /** Returns the entry for an object, creating it on first use. */
+    int32 FindOrAddInstance(UObject* Object, bool bCollection);
+
+    /** Drops the reference of a recycled parameter slot on its instance. */
+    void ReleaseInstance(int32 InstanceIndex);
+
+    /** Writes one parameter to a resolved dynamic material instance. */
+    void WriteDynamicParameter(UMaterialInstanceDynamic& Material, int32 ParameterSlot, const FLinearColor& Value);
+
+private:
+    /** Pending values by object, parameter name and type. */
+    TNsTweenSlotBatcher<FParameter, TTuple<FObjectKey, FName, uint8>> Parameters;
+
+    /** Instance storage; indices are stable while referenced. */
+    TArray<FInstance> Instances;
+
+    /** Instance entries available for reuse. */
+    TArray<int32> FreeInstances;
+
+    /** Instance lookup by object. */
+    TMap<FObjectKey, int32> InstanceLookup;
+
+    /** Instances with written parameters, in first-write order; scratch used while flushing. */
+    TArray<int32> FlushingInstances;
+};
@@ -0,0 +1,214 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Slot storage shared by the batchers: one refcounted slot per target, looked up by TKey, holding the batcher's
+ * pending writes in a TPayload.
+ * Written slots are queued once per flush in first-write order. A slot whose last reference is dropped while it has
+ * pending writes stays alive until they are flushed, since a completing tween writes its final value and is released
+ * in the same tick.
+ * Slot indices are stable while referenced; payload references are invalidated by adding slots.
+ * Game thread only.
+ */
+template <typename TPayload, typename TKey>
+class TNsTweenSlotBatcher
+{
+public:
+    /** Adds a reference to the slot of Key; returns INDEX_NONE when there is none. */
+    int32 AddReference(const TKey& Key)
+    {
+        const int32* Existing = SlotLookup.Find(Key);
+        if (!Existing)
+        {
+            return INDEX_NONE;
+        }
+
+        ++Slots[*Existing].RefCount;
+        return *Existing;
+    }
+
+    /** Creates the slot of Key with one reference and a default payload; Key must not have a slot yet. */
+    int32 Add(const TKey& Key)
+    {
+        const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+        FSlot& Slot = Slots[SlotIndex];
+        Slot.Key = Key;
+        Slot.RefCount = 1;
+        Slot.bDirty = false;
+        Slot.bLive = true;
+        SlotLookup.Add(Key, SlotIndex);
+        return SlotIndex;
+    }
+
+    /** Drops a reference; the slot is recycled once its pending writes are flushed. */
+    void Release(int32 SlotIndex)
+    {
+        Release(SlotIndex, [](int32, TPayload&) {});
+    }
+
+    /** Drops a reference; OnRecycle(SlotIndex, Payload) runs right before the slot is recycled. */
+    template <typename TOnRecycle>
+    void Release(int32 SlotIndex, TOnRecycle&& OnRecycle)
+    {
+        if (!IsValid(SlotIndex) || Slots[SlotIndex].RefCount <= 0)
+        {
+            return;
+        }
+
+        FSlot& Slot = Slots[SlotIndex];
+        if (--Slot.RefCount == 0 && !Slot.bDirty)
+        {
+            FreeSlot(SlotIndex, OnRecycle);
+        }
+    }
+
+    /** True while SlotIndex names a slot that has not been recycled. */
+    bool IsValid(int32 SlotIndex) const
+    {
+        return Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].bLive;
+    }
+
+    /** Payload of a valid slot. */
+    TPayload& operator[](int32 SlotIndex)
+    {
+        return Slots[SlotIndex].Payload;
+    }
+
+    /** Payload of a valid slot. */
+    const TPayload& operator[](int32 SlotIndex) const
+    {
+        return Slots[SlotIndex].Payload;
+    }
+
+    /** Queues a valid slot for the next flush on its first write and returns its payload. */
+    TPayload& MarkDirty(int32 SlotIndex)
+    {
+        FSlot& Slot = Slots[SlotIndex];
+        if (!Slot.bDirty)
+        {
+            Slot.bDirty = true;
+            DirtySlots.Add(SlotIndex);
+        }
+        return Slot.Payload;
+    }
+
+    /** Flushes the written slots; see the overload taking OnRecycle. */
+    template <typename TApply>
+    void Flush(TApply&& Apply)
+    {
+        Flush(Forward<TApply>(Apply), [](int32, TPayload&) {});
+    }
+
+    /**
+     * Hands the slots written since the last flush to Apply(TConstArrayView<int32>), which returns the number of
+     * targets it updated, then recycles the written slots that lost their last reference.
+     * Slots are no longer dirty once Apply runs: writes made from callbacks raised by Apply, and flushes requested by
+     * them, are taken up by the next flush.
+     */
+    template <typename TApply, typename TOnRecycle>
+    void Flush(TApply&& Apply, TOnRecycle&& OnRecycle)
+    {
+        if (bFlushing || DirtySlots.Num() == 0)
+        {
+            return;
+        }
+
+        bFlushing = true;
+        Swap(DirtySlots, FlushingSlots);
+        for (const int32 SlotIndex : FlushingSlots)
+        {
+            Slots[SlotIndex].bDirty = false;
+        }
+
+        LastFlushCount = Apply(TConstArrayView<int32>(FlushingSlots));
+
+        // Slots may have been released, written again or recycled and re-added by Apply's callbacks.
+        for (const int32 SlotIndex : FlushingSlots)
+        {
+            const FSlot& Slot = Slots[SlotIndex];
+            if (Slot.bLive && Slot.RefCount == 0 && !Slot.bDirty)
+            {
+                FreeSlot(SlotIndex, OnRecycle);
+            }
+        }
+
+        FlushingSlots.Reset();
+        bFlushing = false;
+    }
+
+    /** Drops all slots and pending writes. */
+    void Empty()
+    {
+        Slots.Empty();
+        FreeSlots.Empty();
+        SlotLookup.Empty();
+        DirtySlots.Empty();
+        FlushingSlots.Empty();
+        LastFlushCount = 0;
+    }
+
+    /** Number of live slots. */
+    int32 Num() const { return Slots.Num() - FreeSlots.Num(); }
+
+    /** Number of targets updated by the last flush. */
+    int32 GetLastFlushCount() const { return LastFlushCount; }
+
+private:
+    /** One target's slot. */
+    struct FSlot
+    {
+        /** Batcher-specific pending state. */
+        TPayload Payload;
+
+        /** Lookup key, kept for removal after the target is destroyed. */
+        TKey Key;
+
+        /** References held by tweens. */
+        int32 RefCount = 0;
+
+        /** Written since the last flush. */
+        bool bDirty = false;
+
+        /** Not recycled. */
+        bool bLive = false;
+    };
+
+    /** Removes a slot from the lookup, resets its payload and makes it available for reuse. */
+    template <typename TOnRecycle>
+    void FreeSlot(int32 SlotIndex, TOnRecycle& OnRecycle)
+    {
+        FSlot& Slot = Slots[SlotIndex];
+        OnRecycle(SlotIndex, Slot.Payload);
+        SlotLookup.Remove(Slot.Key);
+        Slot.Payload = TPayload();
+        Slot.RefCount = 0;
+        Slot.bDirty = false;
+        Slot.bLive = false;
+        FreeSlots.Add(SlotIndex);
+    }
+
+private:
+    /** Slot storage. */
+    TArray<FSlot> Slots;
+
+    /** Slot indices available for reuse. */
+    TArray<int32> FreeSlots;
+
+    /** Slot lookup by key. */
+    TMap<TKey, int32> SlotLookup;
+
+    /** Slots written since the last flush, in first-write order. */
+    TArray<int32> DirtySlots;
+
+    /** Scratch list swapped with DirtySlots while flushing. */
+    TArray<int32> FlushingSlots;
+
+    /** Targets updated by the last flush. */
+    int32 LastFlushCount = 0;
+
+    /** Guards against flushing again from callbacks raised by a flush. */
+    bool bFlushing = false;
+};
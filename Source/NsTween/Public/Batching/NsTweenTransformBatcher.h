@@ -0,0 +1,146 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Batching/NsTweenSlotBatcher.h"
+#include "NsTweenTypeLibrary.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class USceneComponent;
+
+/** Transform channels a component tween drives. */
+enum class ENsTweenTransformChannel : uint8
+{
+    None = 0,
+    Location = 1 << 0,
+    Rotation = 1 << 1,
+    Scale = 1 << 2,
+    All = Location | Rotation | Scale,
+};
+ENUM_CLASS_FLAGS(ENsTweenTransformChannel);
+
+/**
+ * Collects the transform writes of every component tween during a tick and applies them once per component.
+ * Location, rotation and scale tweens on the same component share a slot, so the component sees a single move
+ * (one transform propagation, overlap update and render-state update) however many tweens drive it.
+ * Every additive layer keeps its last offset in the slot until it is released or baked, and each flush adds the sum of
+ * the kept offsets to the frame's base value: the latest override write, or else the base the layers were added to last
+ * frame, so layers never accumulate into each other across frames and a paused layer keeps its offset while others
+ * move the component. A component moved outside the batcher becomes the new base.
+ * Game thread only.
+ */
+class NSTWEEN_API FNsTweenTransformBatcher
+{
+public:
+    /** Returns the slot gathering writes for a component in the given space, adding a reference to it. */
+    int32 AcquireSlot(USceneComponent* Component, ENsTweenTransformSpace Space);
+
+    /** Drops a reference taken by AcquireSlot; the slot is recycled once its pending writes are flushed. */
+    void ReleaseSlot(int32 SlotIndex);
+
+    /** Records the masked channels for the next flush; sweep and teleport requests accumulate until then. */
+    void Write(int32 SlotIndex, ENsTweenTransformChannel Channels, const FVector& Location, const FQuat& Rotation, const FVector& Scale, bool bSweep, bool bTeleport);
+
+    /**
+     * Sets the offsets of the masked channels kept for Layer, which every flush adds to the component: locations and
+     * scales are summed, rotations composed. A baked offset moves into the base and the layer is dropped, for layers
+     * writing their final value.
+     */
+    void WriteAdditive(int32 SlotIndex, const void* Layer, ENsTweenTransformChannel Channels, const FVector& Location, const FQuat& Rotation, const FVector& Scale, bool bBake, bool bSweep, bool bTeleport);
+
+    /** Drops the offset kept for Layer; the component loses it on the next flush. */
+    void ReleaseLayer(int32 SlotIndex, const void* Layer);
+
+    /** Moves every component with pending writes once. */
+    void Flush();
+
+    /** Drops all slots and pending writes. */
+    void Empty();
+
+    /** Number of components that have live tweens. */
+    int32 Num() const { return Slots.Num(); }
+
+    /** Number of components moved by the last flush. */
+    int32 GetLastFlushCount() const { return Slots.GetLastFlushCount(); }
+
+private:
+    /** Offset kept for one additive layer. */
+    struct FLayer
+    {
+        /** Identifies the writer; strategies pass themselves. */
+        const void* Owner = nullptr;
+
+        /** Channels the layer offsets. */
+        ENsTweenTransformChannel Channels = ENsTweenTransformChannel::None;
+
+        /** Location offset. */
+        FVector Location = FVector::ZeroVector;
+
+        /** Rotation offset. */
+        FQuat Rotation = FQuat::Identity;
+
+        /** Scale offset. */
+        FVector Scale = FVector::ZeroVector;
+    };
+
+    /** Pending transform of one component. */
+    struct FSlot
+    {
+        /** Component moved on flush. */
+        TWeakObjectPtr<USceneComponent> Component;
+
+        /** Pending location. */
+        FVector Location = FVector::ZeroVector;
+
+        /** Pending rotation. */
+        FQuat Rotation = FQuat::Identity;
+
+        /** Pending scale. */
+        FVector Scale = FVector::OneVector;
+
+        /** Offsets of the live additive layers, kept until they are released or baked. */
+        TArray<FLayer, TInlineAllocator<2>> Layers;
+
+        /** Location offsets baked since the last flush; they stay in the base afterwards. */
+        FVector BakeLocation = FVector::ZeroVector;
+
+        /** Rotation offsets baked since the last flush. */
+        FQuat BakeRotation = FQuat::Identity;
+
+        /** Scale offsets baked since the last flush. */
+        FVector BakeScale = FVector::ZeroVector;
+
+        /** Value the additive layers were added to by the last flush, plus baked offsets. */
+        FTransform Base = FTransform::Identity;
+
+        /** Transform set by the last flush, to notice moves made outside the batcher. */
+        FTransform Committed = FTransform::Identity;
+
+        /** Space the pending values are expressed in. */
+        ENsTweenTransformSpace Space = ENsTweenTransformSpace::Relative;
+
+        /** Channels written since the last flush. */
+        ENsTweenTransformChannel DirtyChannels = ENsTweenTransformChannel::None;
+
+        /** Channels with additive writes, bakes or released layers since the last flush. */
+        ENsTweenTransformChannel AdditiveChannels = ENsTweenTransformChannel::None;
+
+        /** Channels whose Base is tracked. */
+        ENsTweenTransformChannel LayeredChannels = ENsTweenTransformChannel::None;
+
+        /** Sweep requested by any write since the last flush. */
+        bool bSweep = false;
+
+        /** Teleport requested by any write since the last flush. */
+        bool bTeleport = false;
+    };
+
+    /** Adds the slot's kept and baked offsets to Transform and records the new base in Slot. */
+    static void ApplyLayers(FSlot& Slot, const FSlot& Pending, ENsTweenTransformChannel Channels, const FTransform& Current, FTransform& Transform);
+
+private:
+    /** Pending transforms by component and space. */
+    TNsTweenSlotBatcher<FSlot, TPair<FObjectKey, uint8>> Slots;
+};
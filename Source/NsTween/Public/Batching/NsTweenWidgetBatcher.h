@@ -0,0 +1,115 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Batching/NsTweenSlotBatcher.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UWidget;
+
+/** Widget channels a widget tween drives. */
+enum class ENsTweenWidgetChannel : uint8
+{
+    None = 0,
+    Translation = 1 << 0,
+    Scale = 1 << 1,
+    Shear = 1 << 2,
+    Angle = 1 << 3,
+    Opacity = 1 << 4,
+    Color = 1 << 5,
+    RenderTransform = Translation | Scale | Shear | Angle,
+};
+ENUM_CLASS_FLAGS(ENsTweenWidgetChannel);
+
+/** Values of every widget channel; tweens only read and write the channels they drive. */
+struct FNsTweenWidgetState
+{
+    /** Render transform translation. */
+    FVector2D Translation = FVector2D::ZeroVector;
+
+    /** Render transform scale. */
+    FVector2D Scale = FVector2D::UnitVector;
+
+    /** Render transform shear. */
+    FVector2D Shear = FVector2D::ZeroVector;
+
+    /** Render transform angle in degrees. */
+    float Angle = 0.f;
+
+    /** Render opacity. */
+    float Opacity = 1.f;
+
+    /** Color and opacity of images, text blocks, borders and user widgets. */
+    FLinearColor Color = FLinearColor::White;
+};
+
+/**
+ * Collects the writes of every widget tween during a tick and applies them once per widget.
+ * Render transform channels are merged into a single SetRenderTransform, which only invalidates the widget's render
+ * transform; opacity and color only invalidate paint. Values equal to the widget's current ones are skipped, so holds
+ * and paused tweens do not invalidate at all and invalidation/retainer caches stay valid between changes.
+ * Game thread only.
+ */
+class NSTWEEN_API FNsTweenWidgetBatcher
+{
+public:
+    /** Returns the slot gathering writes for a widget, adding a reference to it. */
+    int32 AcquireSlot(UWidget* Widget);
+
+    /** Drops a reference taken by AcquireSlot; the slot is recycled once its pending writes are flushed. */
+    void ReleaseSlot(int32 SlotIndex);
+
+    /** Records the masked channels of State for the next flush. */
+    void Write(int32 SlotIndex, ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& State);
+
+    /** Applies every widget with pending writes once. */
+    void Flush();
+
+    /** Drops all slots and pending writes. */
+    void Empty();
+
+    /** Number of widgets that have live tweens. */
+    int32 Num() const { return Slots.Num(); }
+
+    /** Number of widgets invalidated by the last flush. */
+    int32 GetLastFlushCount() const { return Slots.GetLastFlushCount(); }
+
+private:
+    /** Widget setter used for the color channel, resolved once per slot. */
+    enum class EColorTarget : uint8
+    {
+        None,
+        Image,
+        TextBlock,
+        Border,
+        UserWidget,
+    };
+
+    /** Pending state of one widget. */
+    struct FSlot
+    {
+        /** Widget written on flush. */
+        TWeakObjectPtr<UWidget> Widget;
+
+        /** Pending values. */
+        FNsTweenWidgetState Pending;
+
+        /** Channels written since the last flush. */
+        ENsTweenWidgetChannel DirtyChannels = ENsTweenWidgetChannel::None;
+
+        /** Setter used for the color channel. */
+        EColorTarget ColorTarget = EColorTarget::None;
+    };
+
+    /** Reads the widget's current color through the getter matching the slot's color setter. */
+    static FLinearColor GetColor(const UWidget& Widget, EColorTarget ColorTarget);
+
+    /** Applies the pending channels of a slot; returns true when the widget was invalidated. */
+    static bool ApplySlot(UWidget& Widget, FSlot& Slot, ENsTweenWidgetChannel Channels);
+
+private:
+    /** Pending state by widget. */
+    TNsTweenSlotBatcher<FSlot, FObjectKey> Slots;
+};
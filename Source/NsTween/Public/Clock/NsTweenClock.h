@@ -0,0 +1,133 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NsTweenTypeLibrary.h"
+
+/**
+ * What one advance of a clock produced, copied out for the attached tweens.
+ * Tweens read this instead of the clock so callbacks that create or release clocks cannot move it under them.
+ */
+struct FNsTweenClockFrame
+{
+    /** Loop boundaries crossed during the advance. */
+    int32 LoopEvents = 0;
+
+    /** Ping-pong direction swaps during the advance. */
+    int32 PingPongEvents = 0;
+
+    /** Normalized time of the current cycle. */
+    float LinearAlpha = 0.f;
+
+    /** True once the last cycle has played. */
+    bool bFinished = false;
+
+    /** True when the normalized time changed during the advance. */
+    bool bMoved = false;
+};
+
+/**
+ * Playback state shared by a group of tweens: delay, time scale, duration, wrap mode, loops and direction are
+ * advanced once per frame by the subsystem, and every attached tween only evaluates its easing at GetLinearAlpha().
+ * Pausing or seeking the clock moves the whole group in the same frame.
+ * Game thread only.
+ */
+class NSTWEEN_API FNsTweenClock
+{
+public:
+    /** Resets the clock from the timing fields of a spec; callbacks, owner and easing on the spec are ignored. */
+    void Start(const FNsTweenSpec& Timing);
+
+    /** Advances the clock by DeltaSeconds and records this frame's loop, ping-pong and completion events. */
+    void Advance(float DeltaSeconds);
+
+    /** Moves the clock to CycleSeconds into its current cycle and skips any remaining delay; applied on the next advance. */
+    void Seek(float CycleSeconds);
+
+    /** Sets whether the clock, and with it every attached tween, is paused. */
+    void SetPaused(bool bInPaused) { bPaused = bInPaused; }
+
+    /** Returns true while the clock is paused. */
+    bool IsPaused() const { return bPaused; }
+
+    /** Returns true once the last cycle has played. */
+    bool IsFinished() const { return bFinished; }
+
+    /** Returns true while advancing the clock still changes it: it runs, or a seek waits to be published. */
+    bool IsRunning() const { return (!bPaused && !bFinished) || bSeekPending; }
+
+    /** Returns true when the normalized time changed during the last advance. */
+    bool HasMoved() const { return bMoved; }
+
+    /** Returns the normalized time of the current cycle. */
+    float GetLinearAlpha() const { return FMath::Clamp(CycleTime / DurationSeconds, 0.f, 1.f); }
+
+    /** Number of loop boundaries crossed during the last advance. */
+    int32 GetLoopEvents() const { return LoopEvents; }
+
+    /** Number of ping-pong direction swaps during the last advance. */
+    int32 GetPingPongEvents() const { return PingPongEvents; }
+
+    /** Returns the results of the last advance by value. */
+    FNsTweenClockFrame GetFrame() const
+    {
+        FNsTweenClockFrame Frame;
+        Frame.LoopEvents = LoopEvents;
+        Frame.PingPongEvents = PingPongEvents;
+        Frame.LinearAlpha = GetLinearAlpha();
+        Frame.bFinished = bFinished;
+        Frame.bMoved = bMoved;
+        return Frame;
+    }
+
+private:
+    /** Handles a cycle boundary, returning false when the clock finishes. */
+    bool HandleBoundary();
+
+private:
+    /** Length of one cycle in seconds. */
+    float DurationSeconds = 0.5f;
+
+    /** Multiplier applied to incoming delta time. */
+    float TimeScale = 1.f;
+
+    /** Remaining delay before the clock starts moving. */
+    float DelayRemaining = 0.f;
+
+    /** Time within the current cycle. */
+    float CycleTime = 0.f;
+
+    /** Loops or ping-pong pairs to play; zero repeats forever. */
+    int32 LoopCount = 0;
+
+    /** Loops or ping-pong pairs completed so far. */
+    int32 CompletedCycles = 0;
+
+    /** Loop boundaries crossed during the last advance. */
+    int32 LoopEvents = 0;
+
+    /** Ping-pong swaps during the last advance. */
+    int32 PingPongEvents = 0;
+
+    /** How the clock repeats. */
+    ENsTweenWrapMode WrapMode = ENsTweenWrapMode::Once;
+
+    /** Direction each loop restarts in. */
+    ENsTweenDirection Direction = ENsTweenDirection::Forward;
+
+    /** True while the cycle time moves towards the duration. */
+    bool bPlayingForward = true;
+
+    /** True while the clock is paused. */
+    bool bPaused = false;
+
+    /** True once the last cycle has played. */
+    bool bFinished = false;
+
+    /** True when the normalized time changed during the last advance. */
+    bool bMoved = false;
+
+    /** Set by Seek so the next advance reports movement even while paused. */
+    bool bSeekPending = false;
+};
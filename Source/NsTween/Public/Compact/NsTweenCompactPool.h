@@ -0,0 +1,139 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NsTweenTypeLibrary.h"
+
+/** Fired once per compact tween that finishes, with the index of the float it drove inside its target block. */
+DECLARE_DELEGATE_OneParam(FNsTweenCompactComplete, int32 /*TargetIndex*/);
+
+/**
+ * Fixed-size record for a fire-and-forget float tween.
+ * Time is quantized to a 32-bit fraction of the duration and the target is an index into a registered float block,
+ * so a live tween is this record and nothing else: no strategy, easing instance or callback storage.
+ */
+struct FNsTweenCompactRecord
+{
+    /** Value written at the start of the tween. */
+    float StartValue = 0.f;
+
+    /** Value written when the tween completes. */
+    float EndValue = 0.f;
+
+    /** Reciprocal of the duration in seconds. */
+    float InvDuration = 0.f;
+
+    /** Elapsed fraction of the duration, where 2^32 is the end. */
+    uint32 Progress = 0;
+
+    /** Index of the driven float inside its target block. */
+    uint32 TargetIndex = 0;
+
+    /** Target block the tween writes into. */
+    uint16 BlockId = 0;
+
+    /** Easing preset (ENsTweenEase below CustomBezier). */
+    uint8 Preset = 0;
+
+    /** ENsTweenCompactFlags bits. */
+    uint8 Flags = 0;
+};
+
+static_assert(sizeof(FNsTweenCompactRecord) == 24, "Compact tween records are sized for massive counts; keep them at 24 bytes.");
+
+/** Per-record option bits. */
+enum class ENsTweenCompactFlags : uint8
+{
+    None = 0,
+
+    /** Fire the target block's completion delegate when this tween finishes. */
+    NotifyComplete = 1 << 0,
+};
+ENUM_CLASS_FLAGS(ENsTweenCompactFlags);
+
+/**
+ * Memory-minimal tween runner for very large numbers of float tweens.
+ * Records live in fixed-size chunks that are kept when tweens finish, so steady-state spawning does not allocate.
+ * Callers register a float array as a target block and keep it alive until they unregister it.
+ * Game thread only.
+ */
+class NSTWEEN_API FNsTweenCompactPool
+{
+public:
+    /** Records per chunk. */
+    static constexpr int32 ChunkSize = 4096;
+
+    /** Maximum number of simultaneously registered target blocks. */
+    static constexpr int32 MaxBlocks = MAX_uint16;
+
+public:
+    /** Registers a float array as a target block and returns its id, or INDEX_NONE when no block slot is free. */
+    int32 RegisterTargets(TArrayView<float> Values, FNsTweenCompactComplete OnComplete);
+
+    /** Stops every tween writing into the block without completing them and frees the block id. */
+    void UnregisterTargets(int32 BlockId);
+
+    /** Starts a tween on one float of a block; returns false when the block, index or preset is invalid. */
+    bool Spawn(int32 BlockId, int32 TargetIndex, float StartValue, float EndValue, float DurationSeconds, ENsTweenEase Ease, ENsTweenCompactFlags Flags = ENsTweenCompactFlags::None);
+
+    /** Advances every record, writes the eased values and recycles finished records. */
+    void Tick(float DeltaSeconds);
+
+    /** Drops all tweens without completing them; chunks and registered blocks are kept. */
+    void Reset();
+
+    /** Drops all tweens and blocks and frees every chunk. */
+    void Empty();
+
+    /** Number of live compact tweens. */
+    int32 Num() const { return NumRecords; }
+
+    /** Bytes held by chunks, blocks and scratch storage. */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** Fixed block of records; chunks never move once allocated. */
+    struct FChunk
+    {
+        FNsTweenCompactRecord Records[ChunkSize];
+    };
+
+    /** Caller-owned float storage driven by compact tweens. */
+    struct FTargetBlock
+    {
+        /** First float of the block. */
+        float* Values = nullptr;
+
+        /** Number of floats in the block. */
+        int32 Num = 0;
+
+        /** Completion notification for records flagged NotifyComplete. */
+        FNsTweenCompactComplete OnComplete;
+    };
+
+    /** Returns the record at a flat index. */
+    FORCEINLINE FNsTweenCompactRecord& At(int32 Index)
+    {
+        return Chunks[Index / ChunkSize]->Records[Index % ChunkSize];
+    }
+
+    /** Moves the last record into Index and shrinks the live count. */
+    void RemoveAtSwap(int32 Index);
+
+private:
+    /** Record storage. */
+    TArray<TUniquePtr<FChunk>> Chunks;
+
+    /** Live records, packed from index 0. */
+    int32 NumRecords = 0;
+
+    /** Registered target blocks indexed by block id. */
+    TArray<FTargetBlock> Blocks;
+
+    /** Block ids available for reuse. */
+    TArray<int32> FreeBlocks;
+
+    /** Completions gathered during a tick and fired after it, as (block id, target index). */
+    TArray<TPair<int32, int32>> PendingCompletions;
+};
@@ -0,0 +1,16 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IEasingCurve;
+struct FNsTweenSpec;
+
+/** Builds the easing curve for a spec; shared by the subsystem and the Slate runner so both ease identically. */
+struct NSTWEEN_API FNsTweenEasingFactory
+{
+public:
+    /** Returns the easing for the spec's preset. Polynomial presets return one shared stateless instance each. */
+    static TSharedPtr<IEasingCurve> Create(const FNsTweenSpec& Spec);
+};
@@ -15,6 +15,9 @@ public:
     /** Returns the eased alpha for the supplied normalized time. */
     virtual float Evaluate(float T) const override;
 
+    /** Evaluates a preset without an easing instance, for callers that store the preset id themselves. */
+    static float EvaluatePreset(ENsTweenEase Preset, float T);
+
 private:
     static float EaseOutBounce(float T);
 
@@ -2,6 +2,27 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
+#include "Misc/TVariant.h"
+
+struct FNsTweenSpec;
+
+/** Value handed to a running tween by live updates; holds one of the types the typed builders tween. */
+using FNsTweenValue = TVariant<float, double, FVector2D, FVector, FRotator, FQuat, FTransform, FLinearColor>;
+
+/** True when TValue is one of the alternatives of TVariantType. */
+template <typename TValue, typename TVariantType>
+struct TNsTweenVariantHolds
+{
+    static constexpr bool Value = false;
+};
+
+template <typename TValue, typename... TTypes>
+struct TNsTweenVariantHolds<TValue, TVariant<TTypes...>>
+{
+    static constexpr bool Value = (std::is_same_v<TValue, TTypes> || ...);
+};
+
 /** Defines the contract for objects that apply tweened values. */
 class NSTWEEN_API ITweenValue
 {
@@ -9,6 +30,9 @@ public:
     /** Virtual destructor to ensure proper cleanup of derived strategies. */
     virtual ~ITweenValue() = default;
 
+    /** Caches endpoint conversions for the interpolation modes selected on the spec; called once at tween construction. */
+    virtual void Prepare(const FNsTweenSpec& Spec) {}
+
     /** Prepares the strategy before the first update is applied. */
     virtual void Initialize() = 0;
 
@@ -17,5 +41,16 @@ public:
 
     /** Applies the final value when the tween completes. */
     virtual void ApplyFinal() { Apply(1.0f); }
-};
 
+    /**
+     * Moves the end value of a running tween. EasedAlpha is the progress the tween is at: the value there is kept and
+     * the rest of the curve heads to NewEnd. Returns false when the strategy cannot retarget or NewEnd holds another type.
+     */
+    virtual bool SetEndValue(const FNsTweenValue& NewEnd, const FNsTweenSpec& Spec, float EasedAlpha, bool bVelocityContinuous) { return false; }
+
+    /** Writes the value at EasedAlpha into OutValue; returns false when the strategy cannot report its value. */
+    virtual bool SampleValue(float EasedAlpha, FNsTweenValue& OutValue) const { return false; }
+
+    /** Replaces the start value of a tween that has not initialized yet; returns false when NewStart holds another type. */
+    virtual bool SetStartValue(const FNsTweenValue& NewStart, const FNsTweenSpec& Spec) { return false; }
+};
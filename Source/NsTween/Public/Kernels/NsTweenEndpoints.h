@@ -0,0 +1,69 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NsTweenTypeLibrary.h"
+
+/**
+ * Rotation endpoints converted once for the selected rotation mode.
+ * Per-frame evaluation is only the blend plus the conversion to the requested output type.
+ */
+struct NSTWEEN_API FNsTweenRotationEndpoints
+{
+public:
+    /** Caches quaternion endpoints. */
+    void Prepare(const FQuat& A, const FQuat& B, ENsTweenRotationMode InMode);
+
+    /** Caches rotator endpoints. */
+    void Prepare(const FRotator& A, const FRotator& B, ENsTweenRotationMode InMode);
+
+    /** Evaluates the cached rotation as a quaternion. */
+    FQuat EvaluateQuat(float Alpha) const;
+
+    /** Evaluates the cached rotation as a rotator. */
+    FRotator EvaluateRotator(float Alpha) const;
+
+private:
+    /** Start rotation as a normalized quaternion. */
+    FQuat StartQuat = FQuat::Identity;
+
+    /** End rotation as a normalized quaternion on the same hemisphere as StartQuat. */
+    FQuat EndQuat = FQuat::Identity;
+
+    /** Start rotation as euler angles. */
+    FRotator StartRotator = FRotator::ZeroRotator;
+
+    /** Shortest per-axis euler delta from start to end. */
+    FRotator DeltaRotator = FRotator::ZeroRotator;
+
+    /** Mode selected when the endpoints were prepared. */
+    ENsTweenRotationMode Mode = ENsTweenRotationMode::Slerp;
+};
+
+/** Color endpoints converted once into the working space of the selected color mode. */
+struct NSTWEEN_API FNsTweenColorEndpoints
+{
+public:
+    /** Converts both endpoints into the mode's working space. */
+    void Prepare(const FLinearColor& A, const FLinearColor& B, ENsTweenColorMode InMode);
+
+    /** Blends in the working space and converts the result back to linear RGB. */
+    FLinearColor Evaluate(float Alpha) const;
+
+    /** Converts a linear color into OkLab (L, a, b stored in R, G, B; alpha passes through). */
+    static FLinearColor LinearToOkLab(const FLinearColor& Color);
+
+    /** Converts an OkLab color back into linear RGB. */
+    static FLinearColor OkLabToLinear(const FLinearColor& Lab);
+
+private:
+    /** Start color in the working space. */
+    FLinearColor Start = FLinearColor::Black;
+
+    /** End color in the working space. */
+    FLinearColor End = FLinearColor::White;
+
+    /** Mode selected when the endpoints were prepared. */
+    ENsTweenColorMode Mode = ENsTweenColorMode::RGB;
+};
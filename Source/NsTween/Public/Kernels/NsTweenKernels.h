@@ -0,0 +1,106 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Non-owning structure-of-arrays view over vector channels.
+ * Channels are stored as doubles so large world coordinate FVector data round-trips without precision loss.
+ */
+struct FNsTweenVectorSoA
+{
+    /** X channel buffer. */
+    double* X = nullptr;
+
+    /** Y channel buffer. */
+    double* Y = nullptr;
+
+    /** Z channel buffer. */
+    double* Z = nullptr;
+};
+
+/** Non-owning structure-of-arrays view over quaternion channels. */
+struct FNsTweenQuatSoA
+{
+    /** X channel buffer. */
+    double* X = nullptr;
+
+    /** Y channel buffer. */
+    double* Y = nullptr;
+
+    /** Z channel buffer. */
+    double* Z = nullptr;
+
+    /** W channel buffer. */
+    double* W = nullptr;
+};
+
+/** Non-owning structure-of-arrays view over transform channels. */
+struct FNsTweenTransformSoA
+{
+    /** Translation channels. */
+    FNsTweenVectorSoA Translation;
+
+    /** Rotation channels. */
+    FNsTweenQuatSoA Rotation;
+
+    /** Scale channels. */
+    FNsTweenVectorSoA Scale;
+};
+
+/**
+ * VectorRegister based interpolation kernels shared by the value strategies and the callback strategy.
+ * Batch entry points consume SoA buffers four lanes at a time with a scalar tail; every element carries its own alpha,
+ * except in the Uniform variants, which share one alpha across the batch.
+ */
+struct NSTWEEN_API FNsTweenKernels
+{
+public:
+    /** Number of elements processed per register pass. */
+    static constexpr int32 LaneCount = 4;
+
+    /** Writes Start + (End - Start) * Alpha for every element. */
+    static void LerpFloats(const float* Start, const float* End, const float* Alpha, float* Out, int32 Count);
+
+    /** Double precision variant of LerpFloats used for LWC vector channels. */
+    static void LerpDoubles(const double* Start, const double* End, const float* Alpha, double* Out, int32 Count);
+
+    /** Writes Start + (End - Start) * Alpha for every element, with one alpha shared by all of them. */
+    static void LerpFloatsUniform(const float* Start, const float* End, float Alpha, float* Out, int32 Count);
+
+    /** Double precision variant of LerpFloatsUniform, also used for flat runs of LWC vector components. */
+    static void LerpDoublesUniform(const double* Start, const double* End, float Alpha, double* Out, int32 Count);
+
+    /** Interpolates Count vectors channel by channel. */
+    static void LerpVectors(const FNsTweenVectorSoA& Start, const FNsTweenVectorSoA& End, const float* Alpha, const FNsTweenVectorSoA& Out, int32 Count);
+
+    /** Spherically interpolates Count quaternions along the shortest arc, normalizing the results. */
+    static void SlerpQuats(const FNsTweenQuatSoA& Start, const FNsTweenQuatSoA& End, const float* Alpha, const FNsTweenQuatSoA& Out, int32 Count);
+
+    /** Interpolates Count transforms: lerped translation and scale, slerped rotation. */
+    static void LerpTransforms(const FNsTweenTransformSoA& Start, const FNsTweenTransformSoA& End, const float* Alpha, const FNsTweenTransformSoA& Out, int32 Count);
+
+    /** SlerpQuats with one alpha shared by every quaternion. */
+    static void SlerpQuatsUniform(const FNsTweenQuatSoA& Start, const FNsTweenQuatSoA& End, float Alpha, const FNsTweenQuatSoA& Out, int32 Count);
+
+    /** LerpTransforms with one alpha shared by every transform, for spans driven by a single tween. */
+    static void LerpTransformsUniform(const FNsTweenTransformSoA& Start, const FNsTweenTransformSoA& End, float Alpha, const FNsTweenTransformSoA& Out, int32 Count);
+
+    /** Single value vector lerp evaluated in one register. */
+    static FVector LerpVector(const FVector& A, const FVector& B, float Alpha);
+
+    /** Single value shortest-arc slerp evaluated in one register. */
+    static FQuat SlerpQuat(const FQuat& A, const FQuat& B, float Alpha);
+
+    /** Single value transform interpolation built from LerpVector and SlerpQuat. */
+    static FTransform LerpTransform(const FTransform& A, const FTransform& B, float Alpha);
+
+private:
+    /** Resolves the slerp weights for a pair of quaternions given their raw dot product. */
+    static void ComputeSlerpWeights(double CosOmega, double Alpha, double& OutWeightA, double& OutWeightB);
+
+    /** Shared body of SlerpQuats and SlerpQuatsUniform; AlphaAt(Index) returns the alpha of an element. */
+    template <typename TAlphaAt>
+    static void SlerpQuatsImpl(const FNsTweenQuatSoA& Start, const FNsTweenQuatSoA& End, TAlphaAt AlphaAt, const FNsTweenQuatSoA& Out, int32 Count);
+};
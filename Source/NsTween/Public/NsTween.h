@@ -5,87 +5,286 @@
 #include "CoreMinimal.h"
 #include "NsTweenBuilder.h"
 #include "NsTweenTypeLibrary.h"
+#include "Templates/NsTweenBufferStrategy.h"
 #include "Templates/NsTweenCallbackStrategy.h"
+#include "Templates/NsTweenFanOutStrategy.h"
 #include "Templates/NsTweenInterpolator.h"
+#include "Templates/NsTweenStrategyStorage.h"
 
+struct FNsTweenClockFrame;
 class ITweenValue;
 class IEasingCurve;
+class UNsTweenSequence;
 class UNsTweenSubsystem;
 class UCurveFloat;
 
+/**
+ * Cold side of a tween: authoring config, callbacks and strategy ownership.
+ * Cold records live at stable addresses in the subsystem's side table and are only touched when a tween starts,
+ * fires a callback or is torn down.
+ */
+struct NSTWEEN_API FNsTweenColdData
+{
+public:
+    FNsTweenColdData() = default;
+
+    /** Cold records are pinned in the side table and never copied. */
+    FNsTweenColdData(const FNsTweenColdData&) = delete;
+
+    /** Cold records are pinned in the side table and never copied. */
+    FNsTweenColdData& operator=(const FNsTweenColdData&) = delete;
+
+    /** Constructs the value strategy in place inside this record. */
+    template <typename TStrategy, typename... TArgs>
+    TStrategy& EmplaceStrategy(TArgs&&... Args)
+    {
+        return Strategy.template Emplace<TStrategy>(Forward<TArgs>(Args)...);
+    }
+
+    /** Adopts a strategy built outside the record, as produced by the factory spawn path. */
+    void SetStrategy(TSharedPtr<ITweenValue> InStrategy);
+
+    /** Drops the strategy, easing and callbacks and clears the handle so the record can be reused. */
+    void Reset();
+
+    /** Returns the handle of the tween that owns this record. */
+    const FNsTweenHandle& GetHandle() const { return Handle; }
+
+public:
+    /** Handle of the tween that owns this record. */
+    FNsTweenHandle Handle;
+
+    /** Specification the tween was started with; only callbacks and lifetime data are read after start. */
+    FNsTweenSpec Spec;
+
+    /** Strategy responsible for applying value updates, stored inline when it fits. */
+    FNsTweenStrategyStorage Strategy;
+
+    /** Keeps the easing curve alive for the hot record's raw pointer. */
+    TSharedPtr<IEasingCurve> Easing;
+
+    /** Position of the hot record in the subsystem's live pool, or INDEX_NONE while it is not there. */
+    int32 LiveIndex = INDEX_NONE;
+
+    /** Position of the record in the subsystem's side table; kept across resets. */
+    int32 TableIndex = INDEX_NONE;
+};
+
+/**
+ * Hot runtime record of a tween.
+ * Holds exactly what the per-frame update reads so live tweens pack densely, one cache line each; everything else
+ * is reached through the cold record when an event fires.
+ */
 struct NSTWEEN_API FNsTween
 {
 public:
-    /** Constructs a tween using the provided runtime data. */
-    FNsTween(const FNsTweenHandle& InHandle, FNsTweenSpec InSpec, TSharedPtr<ITweenValue> InStrategy, TSharedPtr<IEasingCurve> InEasing);
+    /** Constructs an inactive record. */
+    FNsTween();
+
+    /** Binds the record to a cold entry, moves the spec into it and copies the per-frame fields out of it. */
+    void Start(FNsTweenColdData& InCold, FNsTweenSpec&& InSpec, TSharedPtr<IEasingCurve> InEasing);
 
     /** Advances the tween state by the provided delta time. */
     bool Tick(float DeltaSeconds);
 
+    /**
+     * Advances the tween state by the provided delta time. When the tween completes, OutLeftoverSeconds receives the
+     * unscaled part of DeltaSeconds it did not use; otherwise it is negative.
+     */
+    bool Tick(float DeltaSeconds, float& OutLeftoverSeconds);
+
+    /**
+     * Applies the attached clock's normalized time and events; the clock has already advanced this frame.
+     * The frame is taken by value because the loop and ping-pong callbacks may create or release clocks.
+     * OutLeftoverSeconds is zero when the tween completes and negative otherwise.
+     */
+    bool TickOnClock(FNsTweenClockFrame Frame, float& OutLeftoverSeconds);
+
+    /** Initializes the strategy and applies the start value now instead of on the first tick; delayed tweens only initialize. */
+    void ApplyStart();
+
     /** Cancels the tween and optionally applies the final value. */
     void Cancel(bool bApplyFinal);
 
     /** Sets whether the tween is currently paused. */
     void SetPaused(bool bInPaused);
 
+    /** Changes the time scale of the running tween; tweens driven by a clock keep the clock's. */
+    void SetTimeScale(float InTimeScale);
+
+    /** Changes the cycle duration, keeping the progress through the current cycle. */
+    void SetDuration(float InDurationSeconds);
+
+    /** Swaps the easing curve; the next update evaluates the new curve at the current progress. */
+    void SetEasing(TSharedPtr<IEasingCurve> InEasing);
+
+    /**
+     * Moves the end value from LinearAlpha, the tween's current normalized time, keeping the value there. Returns
+     * false when the strategy cannot retarget or NewEnd holds another type than the tweened one.
+     */
+    bool SetEndValue(const FNsTweenValue& NewEnd, float LinearAlpha, bool bVelocityContinuous);
+
+    /**
+     * Makes Next, started but not yet initialized, begin from the value this tween has at LinearAlpha. Returns false
+     * when either strategy cannot exchange values of their type.
+     */
+    bool HandOverTo(FNsTween& Next, float LinearAlpha) const;
+
+    /** Returns the normalized time through the current cycle of a tween running on its own timing. */
+    float GetLinearAlpha() const { return FMath::Clamp(CycleTime / DurationSeconds, 0.f, 1.f); }
+
     /** Returns true when the tween is still actively running. */
     bool IsActive() const { return bActive; }
 
     /** Returns the handle that uniquely identifies this tween. */
     const FNsTweenHandle& GetHandle() const { return Handle; }
 
+    /** Returns the shared clock driving this tween, invalid when it runs on its own timing. */
+    const FNsTweenClockHandle& GetClock() const { return Clock; }
+
+    /** Returns the cold record holding this tween's config and callbacks. */
+    FNsTweenColdData* GetColdData() const { return Cold; }
+
     /** Generic convenience wrapper that forwards to the correct typed overload. */
     template <typename TCallable, typename TType>
     static FNsTweenBuilder Play(const TType& StartValue, const TType& EndValue, float DurationSeconds, ENsTweenEase Ease, TCallable&& Update)
     {
-        TFunction<void(const TType&)> Fn(Forward<TCallable>(Update));
-        return BuildT<TType>(StartValue, EndValue, DurationSeconds, Ease, MoveTemp(Fn));
+        return BuildT<TType>(StartValue, EndValue, DurationSeconds, Ease, Forward<TCallable>(Update));
     }
 
     /** Constructs a builder using explicit tween specification data. */
     static FNsTweenBuilder Play(FNsTweenSpec Spec, TFunction<TSharedPtr<ITweenValue>()> StrategyFactory);
 
+    /**
+     * Plays one tween driving NumTargets values: timing and easing are evaluated once per frame and Update(TargetIndex,
+     * Value) is called for every target. StartValues/EndValues hold one pair shared by every target, blended once and
+     * broadcast, or one value per target.
+     */
+    template <typename TType, typename TCallable>
+    static FNsTweenBuilder PlayFanOut(TArray<TType> StartValues, TArray<TType> EndValues, int32 NumTargets, float DurationSeconds, ENsTweenEase Ease, TCallable&& Update)
+    {
+        using FStrategy = TNsTweenFanOutValue<TType, typename TDecay<TCallable>::Type>;
+
+        const bool bValidEndpoints = StartValues.Num() == EndValues.Num() && (StartValues.Num() == 1 || StartValues.Num() == NumTargets);
+        if (NumTargets <= 0 || !bValidEndpoints)
+        {
+            return FNsTweenBuilder();
+        }
+
+        FNsTweenColdData* Record = ReserveRecord();
+        if (!Record)
+        {
+            return FNsTweenBuilder();
+        }
+
+        Record->EmplaceStrategy<FStrategy>(MoveTemp(StartValues), MoveTemp(EndValues), NumTargets, Forward<TCallable>(Update));
+        return FNsTweenBuilder(MakeSpec(DurationSeconds, Ease), Record->GetHandle());
+    }
+
+    /** Plays one tween writing the same blended value into every target. */
+    template <typename TType>
+    static FNsTweenBuilder PlayFanOut(const TType& StartValue, const TType& EndValue, TArray<TType*> Targets, float DurationSeconds, ENsTweenEase Ease)
+    {
+        const int32 NumTargets = Targets.Num();
+        return PlayFanOut<TType>(TArray<TType>({ StartValue }), TArray<TType>({ EndValue }), NumTargets, DurationSeconds, Ease,
+            [Targets = MoveTemp(Targets)](int32 Index, const TType& Value)
+            {
+                if (TType* Target = Targets[Index])
+                {
+                    *Target = Value;
+                }
+            });
+    }
+
+    /**
+     * Plays one tween blending a caller-owned buffer between two snapshots of the same length, e.g. morph weights or
+     * spline points. Supports float, double, FVector2D and FVector. Chain OnComplete on the builder to be told when it
+     * finishes; the buffer must outlive the tween or the tween must be cancelled first.
+     */
+    template <typename TType>
+    static FNsTweenBuilder PlayBuffer(TArrayView<TType> Target, TArray<TType> StartValues, TArray<TType> EndValues, float DurationSeconds, ENsTweenEase Ease)
+    {
+        if (Target.Num() == 0 || StartValues.Num() != Target.Num() || EndValues.Num() != Target.Num())
+        {
+            return FNsTweenBuilder();
+        }
+
+        FNsTweenColdData* Record = ReserveRecord();
+        if (!Record)
+        {
+            return FNsTweenBuilder();
+        }
+
+        Record->EmplaceStrategy<TNsTweenBufferValue<TType>>(Target, MoveTemp(StartValues), MoveTemp(EndValues));
+        return FNsTweenBuilder(MakeSpec(DurationSeconds, Ease), Record->GetHandle());
+    }
+
+    /**
+     * Plays a sequence asset as one tween over its compiled timeline. Bindings holds one strategy per item, in item
+     * order; null entries leave an item unbound. Each binding is prepared with its item's interpolation modes and
+     * initialized the first time its segment starts. Players share the asset's compiled timeline and only own their
+     * playhead and bindings. Builder settings apply to the sequence as a whole; ping-pong and backward playback rewind
+     * only the segments the playhead crosses.
+     */
+    static FNsTweenBuilder PlaySequence(const UNsTweenSequence* Sequence, TArray<TSharedPtr<ITweenValue>> Bindings);
+
 private:
+    /** Runs the checks and lazy initialization shared by both tick paths; returns false when the tween must not advance. */
+    bool BeginTick();
+
     /** Applies the tween update for the given cycle time. */
     void Apply(float CycleTime);
 
+    /** Evaluates the easing at a normalized time and applies the result. */
+    void ApplyAlpha(float LinearAlpha);
+
     /** Handles wrap-mode transitions, returning false when the tween completes. */
     bool HandleBoundary(float& RemainingTime);
 
-    /** Default typed builder that wires up the callback strategy for the tween. */
-    template <typename TType>
-    static FNsTweenBuilder BuildT(const TType& StartValue, const TType& EndValue, float DurationSeconds, ENsTweenEase Ease, TFunction<void(const TType&)> Update)
+    /** Applies the final value, fires completion and deactivates the tween. */
+    void Complete();
+
+    /**
+     * Default typed builder that wires up the callback strategy for the tween.
+     * The strategy, with the update callable stored inline, is constructed directly in a record reserved from the
+     * subsystem, so spawning a common value type performs no heap allocation.
+     */
+    template <typename TType, typename TCallable>
+    static FNsTweenBuilder BuildT(const TType& StartValue, const TType& EndValue, float DurationSeconds, ENsTweenEase Ease, TCallable&& Update)
     {
-        FNsTweenSpec Spec;
-        Spec.DurationSeconds = FMath::Max(DurationSeconds, 0.f);
-        Spec.DelaySeconds = 0.f;
-        Spec.TimeScale = 1.f;
-        Spec.WrapMode = ENsTweenWrapMode::Once;
-        Spec.LoopCount = 0;
-        Spec.Direction = ENsTweenDirection::Forward;
-        Spec.EasingPreset = Ease;
-
-        TFunction<void(const TType&)> Owned = MoveTemp(Update);
-        return Play(
-            MoveTemp(Spec),
-            [StartValue, EndValue, Owned = MoveTemp(Owned)]() mutable -> TSharedPtr<class ITweenValue>
-            {
-                return MakeNsTweenCallbackStrategy<TType>(StartValue, EndValue, MoveTemp(Owned));
-            });
+        using FStrategy = TNsTweenCallbackValue<TType, typename TDecay<TCallable>::Type>;
+
+        FNsTweenColdData* Record = ReserveRecord();
+        if (!Record)
+        {
+            return FNsTweenBuilder();
+        }
+
+        Record->EmplaceStrategy<FStrategy>(StartValue, EndValue, Forward<TCallable>(Update));
+        return FNsTweenBuilder(MakeSpec(DurationSeconds, Ease), Record->GetHandle());
     }
 
+    /** Default spec of the typed builders: plays once, forward, with no delay. */
+    static FNsTweenSpec MakeSpec(float DurationSeconds, ENsTweenEase Ease);
+
+    /** Reserves an empty record in the active subsystem, or returns nullptr when no subsystem is available. */
+    static FNsTweenColdData* ReserveRecord();
+
 private:
-    /** The handle assigned to this tween. */
-    FNsTweenHandle Handle;
+    /** Strategy applying value updates; owned by the cold record. */
+    ITweenValue* Strategy = nullptr;
 
-    /** Specification describing how the tween behaves. */
-    FNsTweenSpec Spec;
+    /** Easing curve used to transform normalized time; kept alive by the cold record. */
+    IEasingCurve* Easing = nullptr;
 
-    /** Strategy responsible for applying value updates. */
-    TSharedPtr<ITweenValue> Strategy;
+    /** Config, callbacks and ownership for this tween. */
+    FNsTweenColdData* Cold = nullptr;
 
-    /** Easing curve used to transform normalized time. */
-    TSharedPtr<IEasingCurve> Easing;
+    /** Duration of one cycle in seconds. */
+    float DurationSeconds = 0.0f;
+
+    /** Multiplier applied to incoming delta time. */
+    float TimeScale = 1.0f;
 
     /** Remaining delay before the tween starts. */
     float DelayRemaining = 0.0f;
@@ -93,25 +292,47 @@ private:
     /** Accumulated time within the current tween cycle. */
     float CycleTime = 0.0f;
 
+    /** Number of loops or ping-pong pairs to play; zero repeats forever. */
+    int32 LoopCount = 0;
+
     /** Number of completed cycles for looping tweens. */
     int32 CompletedCycles = 0;
 
     /** Number of completed ping-pong direction pairs. */
     int32 CompletedPingPongPairs = 0;
 
+    /** The handle assigned to this tween. */
+    FNsTweenHandle Handle;
+
+    /** Shared clock replacing the timing fields above when valid. */
+    FNsTweenClockHandle Clock;
+
+    /** How the tween behaves at cycle boundaries. */
+    ENsTweenWrapMode WrapMode = ENsTweenWrapMode::Once;
+
+    /** Direction each loop restarts in. */
+    ENsTweenDirection Direction = ENsTweenDirection::Forward;
+
     /** Tracks whether the tween is still active. */
-    bool bActive = true;
+    uint8 bActive : 1;
 
     /** Tracks whether the tween is currently paused. */
-    bool bPaused = false;
+    uint8 bPaused : 1;
 
     /** Tracks whether the tween strategy has been initialized. */
-    bool bInitialized = false;
+    uint8 bInitialized : 1;
 
     /** Tracks whether the tween is currently playing forward. */
-    bool bPlayingForward = true;
+    uint8 bPlayingForward : 1;
 
     /** Remembers if the tween started by playing backward. */
-    bool bStartBackward = false;
+    uint8 bStartBackward : 1;
+
+    /** Set when the tween must stop once its owner is gone. */
+    uint8 bEnforceOwnerLifetime : 1;
+
+    /** Set when the spec has an OnUpdate binding, so Apply skips the cold record otherwise. */
+    uint8 bHasUpdateCallback : 1;
 };
 
+static_assert(sizeof(FNsTween) <= 64, "FNsTween is the per-frame hot record and must fit a single cache line; move new fields to FNsTweenColdData.");
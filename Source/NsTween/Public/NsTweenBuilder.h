@@ -6,6 +6,7 @@
 #include "NsTweenTypeLibrary.h"
 #include "Templates/Function.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
 
 class ITweenValue;
 class IEasingCurve;
@@ -42,15 +43,57 @@ public:
     /** Sets an initial delay before the tween begins playback. */
     FNsTweenBuilder& SetDelay(float DelaySeconds);
 
-    /** Adjusts the time scale applied while the tween plays. */
+    /** Adjusts the time scale applied while the tween plays; once activated, the running tween is changed in place. */
     FNsTweenBuilder& SetTimeScale(float TimeScale);
 
-    /** Specifies the curve asset used for easing evaluation. */
+    /** Changes the cycle duration; once activated, the running tween keeps its progress through the current cycle. */
+    FNsTweenBuilder& SetDuration(float DurationSeconds);
+
+    /** Selects the easing preset; once activated, the running tween swaps its curve in place. */
+    FNsTweenBuilder& SetEase(ENsTweenEase Ease);
+
+    /** Specifies the curve asset used for easing evaluation; once activated, the running tween swaps its curve in place. */
     FNsTweenBuilder& SetCurveAsset(UCurveFloat* Curve);
 
+    /**
+     * Moves the end value of the running tween, activating it first. The value reached so far is kept and the easing
+     * carries on towards the new end over the time left; with bVelocityContinuous, float, vector and linear color
+     * tweens also keep their current speed. TType must be the tweened value type. Only tweens played through
+     * FNsTween::Play retarget.
+     */
+    template <typename TType>
+    FNsTweenBuilder& SetEndValue(const TType& EndValue, bool bVelocityContinuous = false)
+    {
+        return SetEndValue(FNsTweenValue(TInPlaceType<TType>(), EndValue), bVelocityContinuous);
+    }
+
+    /** Moves the end value of the running tween to the value held by EndValue. */
+    FNsTweenBuilder& SetEndValue(const FNsTweenValue& EndValue, bool bVelocityContinuous = false);
+
+    /** Selects how rotation, quaternion and transform tweens interpolate their rotation. */
+    FNsTweenBuilder& SetRotationMode(ENsTweenRotationMode Mode);
+
+    /** Selects the color space used by color tweens. */
+    FNsTweenBuilder& SetColorMode(ENsTweenColorMode Mode);
+
     /** Associates the tween with an owning UObject to gate its lifetime. */
     FNsTweenBuilder& SetOwner(UObject* InOwner);
 
+    /** Drives the tween from a shared clock created with UNsTweenSubsystem::CreateClock instead of its own timing. */
+    FNsTweenBuilder& SetClock(const FNsTweenClockHandle& Clock);
+
+    /**
+     * Names what the tween drives, an object and one of its properties or channels. When it starts while another
+     * tween drives the same target, Overwrite decides whether that tween is killed, blended from or waited for.
+     */
+    FNsTweenBuilder& SetTarget(UObject* Object, FName Channel = NAME_None, ENsTweenOverwrite Overwrite = ENsTweenOverwrite::Kill);
+
+    /**
+     * Spawns the tween synchronously when it activates on the game thread: it joins the live pool and applies its
+     * start value at once instead of waiting for the next tick. Other threads still go through the queue.
+     */
+    FNsTweenBuilder& SetImmediate(bool bEnable = true);
+
     /** Registers a callback executed when the tween completes. */
     FNsTweenBuilder& OnComplete(TFunction<void()> Callback);
 
@@ -60,6 +103,16 @@ public:
     /** Registers a callback executed on every ping-pong direction swap. */
     FNsTweenBuilder& OnPingPong(TFunction<void()> Callback);
 
+    /**
+     * Starts Next when the last tween chained with Then (or this tween) completes, in the same tick and with the
+     * frame time left over, without going through the command queue. Must be called before this builder activates;
+     * otherwise Next plays on its own. Successors of a tween that is cancelled or stopped never start.
+     */
+    FNsTweenBuilder& Then(FNsTweenBuilder&& Next);
+
+    /** Starts Other together with the tween added by the last Then, or together with this tween when none was. */
+    FNsTweenBuilder& Join(FNsTweenBuilder&& Other);
+
     /** Pauses the tween represented by this builder. */
     void Pause() const;
 
@@ -88,15 +141,36 @@ private:
     /** Constructs the builder from explicit specification data. */
     FNsTweenBuilder(FNsTweenSpec&& InSpec, TFunction<TSharedPtr<ITweenValue>()>&& InStrategyFactory);
 
+    /** Constructs the builder for a record already reserved in the subsystem with its strategy in place. */
+    FNsTweenBuilder(FNsTweenSpec&& InSpec, const FNsTweenHandle& InReservedHandle);
+
+    /** Applies the initial wrap-mode and owner state shared by both constructors. */
+    void InitializeFromSpec();
+
     /** Activates the tween within the subsystem. */
     void Activate() const;
 
+    /** Activates the tween and its chain; with a valid Predecessor the tween waits for it to complete. */
+    void ActivateAfter(const FNsTweenHandle& Predecessor) const;
+
+    /** Hands this builder's tween to the subsystem, started now or linked to Predecessor. */
+    void Spawn(const FNsTweenHandle& Predecessor) const;
+
+    /** Marks the builder and its chain activated without spawning, releasing any reserved record. */
+    void Disarm() const;
+
+    /** Returns the builder the next Then or Join attaches to. */
+    FNsTweenBuilder& GetChainTail();
+
     /** Updates the wrap mode based on ping-pong and loop settings. */
     void UpdateWrapMode() const;
 
     /** Returns true when configuration can still be modified. */
     bool CanConfigure() const;
 
+    /** Returns the subsystem running the activated tween, or nullptr before activation. */
+    UNsTweenSubsystem* GetRunningSubsystem() const;
+
     /** Configures the completion callback on the specification. */
     void ConfigureComplete(TFunction<void()>&& Callback) const;
 
@@ -125,9 +199,18 @@ private:
     /** Handle returned by the subsystem after activation. */
     mutable FNsTweenHandle Handle;
 
+    /** Tween started when this one completes. */
+    TUniquePtr<FNsTweenBuilder> ThenBuilder;
+
+    /** Tweens started together with this one. */
+    TArray<TUniquePtr<FNsTweenBuilder>> JoinBuilders;
+
     /** True when the builder has been initialized with a specification. */
     bool bHasSpec = false;
 
+    /** True when Handle names a reserved record that only needs its spec to start. */
+    bool bReserved = false;
+
     /** True when the tween loops continuously. */
     mutable bool bLooping = false;
 
@@ -137,5 +220,8 @@ private:
     /** True once the tween has been activated. */
     mutable bool bActivated = false;
 
+    /** True when activation spawns synchronously on the game thread. */
+    bool bImmediate = false;
+
     friend struct FNsTween;
 };
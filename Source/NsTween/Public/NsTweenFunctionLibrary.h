@@ -7,9 +7,15 @@
 #include "NsTweenBuilder.h"
 #include "NsTweenSubsystem.h"
 #include "NsTweenTypeLibrary.h"
+#include "Property/NsTweenPropertyPlan.h"
 #include "NsTweenFunctionLibrary.generated.h"
 
 class UNsTweenSubsystem;
+class UInstancedStaticMeshComponent;
+class UMaterialInstanceDynamic;
+class UMaterialParameterCollection;
+class USceneComponent;
+class UWidget;
 
 /**
  * Helper that routes every Blueprint spawn call through the same builder logic.
@@ -27,6 +33,65 @@ FNsTweenHandle PlayTypedTween(TValue& Target, const TValue& StartValue, const TV
     return Builder.GetHandle();
 }
 
+/**
+ * Plays a tween that drives a property of Target by reflection path, e.g. "RelativeLocation" or "Settings.Intensity".
+ * Floats and doubles drive scalar properties; any other USTRUCT type drives a struct property of that type field by field.
+ * The path is resolved once here; ticking only writes through the cached offsets.
+ */
+template <typename TValue>
+FNsTweenHandle PlayPropertyTween(UObject* Target, const FString& PropertyPath, const TValue& StartValue, const TValue& EndValue, const FNsTweenSpec& Spec)
+{
+    TSharedPtr<ITweenValue> Strategy;
+    if constexpr (std::is_arithmetic_v<TValue>)
+    {
+        Strategy = MakeNsTweenPropertyStrategy(Target, PropertyPath, static_cast<double>(StartValue), static_cast<double>(EndValue));
+    }
+    else
+    {
+        Strategy = MakeNsTweenPropertyStrategy(Target, PropertyPath, TBaseStructure<TValue>::Get(), &StartValue, &EndValue);
+    }
+
+    if (!Strategy.IsValid())
+    {
+        return FNsTweenHandle();
+    }
+
+    const FNsTweenBuilder Builder = FNsTween::Play(Spec, [Strategy]() -> TSharedPtr<ITweenValue>
+    {
+        return Strategy;
+    });
+
+    return Builder.GetHandle();
+}
+
+/**
+ * Plays a tween on the selected transform channels of a scene component.
+ * Writes go through the subsystem's transform batcher, so location, rotation and scale tweens on the same component
+ * cost one move per tick between them. Channels not selected are left as they are.
+ */
+NSTWEEN_API FNsTweenHandle PlayComponentTransformTween(USceneComponent* Component, ENsTweenTransformChannel Channels, const FTransform& StartValue, const FTransform& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options = FNsTweenMoveOptions());
+
+/**
+ * Plays a tween on the selected channels of a UMG widget.
+ * Writes go through the subsystem's widget batcher, so every tween on a widget costs one render-transform update and
+ * one paint invalidation per tick between them, and unchanged values invalidate nothing.
+ */
+NSTWEEN_API FNsTweenHandle PlayWidgetTween(UWidget* Widget, ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& StartValue, const FNsTweenWidgetState& EndValue, const FNsTweenSpec& Spec);
+
+/**
+ * Plays a tween on the transforms of a contiguous span of instances of an ISM or HISM component, in component space.
+ * StartValues and EndValues hold one transform per instance. Writes go through the subsystem's instance batcher, so all
+ * tweens on a component cost one batched transform update and one render state update per tick between them.
+ */
+NSTWEEN_API FNsTweenHandle PlayInstanceTransformsTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, TConstArrayView<FTransform> StartValues, TConstArrayView<FTransform> EndValues, const FNsTweenSpec& Spec);
+
+/**
+ * Plays a tween on NumCustomData per-instance custom data floats, starting at CustomDataIndex, of a contiguous span of
+ * instances. StartValues and EndValues hold NumCustomData floats per instance, instance by instance. Batched like
+ * PlayInstanceTransformsTween.
+ */
+NSTWEEN_API FNsTweenHandle PlayInstanceCustomDataTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, int32 CustomDataIndex, int32 NumCustomData, TConstArrayView<float> StartValues, TConstArrayView<float> EndValues, const FNsTweenSpec& Spec);
+
 /** Invokes a subsystem command if the singleton is currently available. */
 template <typename TCallback>
 void DispatchToSubsystem(FNsTweenHandle Handle, TCallback&& Callback)
@@ -64,6 +129,86 @@ public:
     UFUNCTION(BlueprintCallable, Category = "NsTween", meta = (WorldContext = "WorldContextObject"))
     static FNsTweenHandle PlayColorTween(const FLinearColor& StartValue, const FLinearColor& EndValue, UPARAM(ref) FLinearColor& Target, const FNsTweenSpec& Spec);
 
+    /** Plays a tween on a float or double property of Target, addressed by a dot-separated property path. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Property")
+    static FNsTweenHandle PlayFloatPropertyTween(UObject* Target, const FString& PropertyPath, float StartValue, float EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a vector property of Target, addressed by a dot-separated property path. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Property")
+    static FNsTweenHandle PlayVectorPropertyTween(UObject* Target, const FString& PropertyPath, const FVector& StartValue, const FVector& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a rotator property of Target, addressed by a dot-separated property path. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Property")
+    static FNsTweenHandle PlayRotatorPropertyTween(UObject* Target, const FString& PropertyPath, const FRotator& StartValue, const FRotator& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a transform property of Target, addressed by a dot-separated property path. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Property")
+    static FNsTweenHandle PlayTransformPropertyTween(UObject* Target, const FString& PropertyPath, const FTransform& StartValue, const FTransform& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a linear color property of Target, addressed by a dot-separated property path. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Property")
+    static FNsTweenHandle PlayColorPropertyTween(UObject* Target, const FString& PropertyPath, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a location tween on a scene component, batched with the component's other transform tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Component")
+    static FNsTweenHandle PlayComponentLocationTween(USceneComponent* Component, const FVector& StartValue, const FVector& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options);
+
+    /** Plays a rotation tween on a scene component, batched with the component's other transform tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Component")
+    static FNsTweenHandle PlayComponentRotationTween(USceneComponent* Component, const FRotator& StartValue, const FRotator& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options);
+
+    /** Plays a scale tween on a scene component, batched with the component's other transform tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Component")
+    static FNsTweenHandle PlayComponentScaleTween(USceneComponent* Component, const FVector& StartValue, const FVector& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options);
+
+    /** Plays a full transform tween on a scene component, batched with the component's other transform tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Component")
+    static FNsTweenHandle PlayComponentTransformTween(USceneComponent* Component, const FTransform& StartValue, const FTransform& EndValue, const FNsTweenSpec& Spec, const FNsTweenMoveOptions& Options);
+
+    /** Plays a tween on a scalar parameter of a dynamic material instance; the parameter index is resolved once. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Material")
+    static FNsTweenHandle PlayMaterialScalarTween(UMaterialInstanceDynamic* Material, FName ParameterName, float StartValue, float EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a vector parameter of a dynamic material instance; the parameter index is resolved once. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Material")
+    static FNsTweenHandle PlayMaterialVectorTween(UMaterialInstanceDynamic* Material, FName ParameterName, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a scalar parameter of the world's instance of a material parameter collection. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Material", meta = (WorldContext = "WorldContextObject"))
+    static FNsTweenHandle PlayParameterCollectionScalarTween(UObject* WorldContextObject, UMaterialParameterCollection* Collection, FName ParameterName, float StartValue, float EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on a vector parameter of the world's instance of a material parameter collection. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Material", meta = (WorldContext = "WorldContextObject"))
+    static FNsTweenHandle PlayParameterCollectionVectorTween(UObject* WorldContextObject, UMaterialParameterCollection* Collection, FName ParameterName, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a render translation tween on a widget, batched with the widget's other tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Widget")
+    static FNsTweenHandle PlayWidgetTranslationTween(UWidget* Widget, FVector2D StartValue, FVector2D EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a render scale tween on a widget, batched with the widget's other tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Widget")
+    static FNsTweenHandle PlayWidgetScaleTween(UWidget* Widget, FVector2D StartValue, FVector2D EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a render angle tween (degrees) on a widget, batched with the widget's other tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Widget")
+    static FNsTweenHandle PlayWidgetAngleTween(UWidget* Widget, float StartValue, float EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a render opacity tween on a widget, batched with the widget's other tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Widget")
+    static FNsTweenHandle PlayWidgetOpacityTween(UWidget* Widget, float StartValue, float EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a color and opacity tween on an image, text block, border or user widget, batched with the widget's other tweens. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Widget")
+    static FNsTweenHandle PlayWidgetColorTween(UWidget* Widget, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on the transforms (component space) of instances FirstInstance onwards, one transform per instance. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Instances")
+    static FNsTweenHandle PlayInstanceTransformsTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, const TArray<FTransform>& StartValues, const TArray<FTransform>& EndValues, const FNsTweenSpec& Spec);
+
+    /** Plays a tween on one custom data float of instances FirstInstance onwards, one value per instance. */
+    UFUNCTION(BlueprintCallable, Category = "NsTween|Instances")
+    static FNsTweenHandle PlayInstanceCustomDataTween(UInstancedStaticMeshComponent* Component, int32 FirstInstance, int32 CustomDataIndex, const TArray<float>& StartValues, const TArray<float>& EndValues, const FNsTweenSpec& Spec);
+
     /** Pauses the tween represented by the supplied handle. */
     UFUNCTION(BlueprintCallable, Category = "NsTween", meta = (WorldContext = "WorldContextObject"))
     static void PauseTween(FNsTweenHandle Handle);
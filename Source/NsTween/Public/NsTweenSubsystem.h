@@ -3,12 +3,21 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Batching/NsTweenInstanceBatcher.h"
+#include "Batching/NsTweenMaterialBatcher.h"
+#include "Batching/NsTweenTransformBatcher.h"
+#include "Batching/NsTweenWidgetBatcher.h"
+#include "Clock/NsTweenClock.h"
+#include "Compact/NsTweenCompactPool.h"
 #include "Containers/Queue.h"
 #include "Containers/Ticker.h"
 #include "HAL/ThreadSafeCounter.h"
 #include "Misc/AutomationTest.h"
+#include "NsTween.h"
 #include "NsTweenTypeLibrary.h"
+#include "Spring/NsTweenSpring.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include <atomic>
 #include "NsTweenSubsystem.generated.h"
 
 class ITweenValue;
@@ -21,9 +30,77 @@ class FNsTweenBezierEasing;
 class FNsTweenPolynomialEasing;
 class FNsTweenCurveAssetEasingAdapter;
 struct FNsTween;
+struct FNsTweenColdData;
 
-UCLASS()
-class UNsTweenSubsystem : public UGameInstanceSubsystem
+/** Snapshot of the memory held by the tween runtime. */
+struct FNsTweenMemoryStats
+{
+    /** Tweens currently ticking */
+    int32 LiveTweens = 0;
+
+    /** Tweens started but not yet published to the live pool */
+    int32 PendingTweens = 0;
+
+    /** Records reserved by builders that have not activated yet */
+    int32 ReservedTweens = 0;
+
+    /** Tweens started by a chain, waiting for their predecessor to complete */
+    int32 LinkedTweens = 0;
+
+    /** Cold records ready for reuse */
+    int32 FreeRecords = 0;
+
+    /** Cold records allocated in total */
+    int32 ColdRecords = 0;
+
+    /** Size of one hot record */
+    int32 HotRecordBytes = 0;
+
+    /** Size of one cold record */
+    int32 ColdRecordBytes = 0;
+
+    /** Bytes allocated for the hot arrays */
+    SIZE_T HotAllocatedBytes = 0;
+
+    /** Bytes allocated for the cold side table and its bookkeeping */
+    SIZE_T ColdAllocatedBytes = 0;
+
+    /** Spawns that reused an idle cold record since the subsystem started */
+    int64 RecycledRecords = 0;
+
+    /** Spawns that had to allocate a cold record since the subsystem started */
+    int64 AllocatedRecords = 0;
+
+    /** Released records freed because MaxFreeTweens records were already idle */
+    int64 DiscardedRecords = 0;
+
+    /** Share of spawns served by a recycled record, 0 to 1 */
+    float RecycleHitRate = 0.f;
+
+    /** Heap blocks kept by cold records for strategies too large to live inline */
+    SIZE_T StrategyHeapBytes = 0;
+
+    /** Compact float tweens currently running */
+    int32 CompactTweens = 0;
+
+    /** Size of one compact record */
+    int32 CompactRecordBytes = 0;
+
+    /** Bytes allocated by the compact pool, including chunk slack */
+    SIZE_T CompactAllocatedBytes = 0;
+
+    /** Live springs, awake or asleep */
+    int32 Springs = 0;
+
+    /** Springs still moving towards their target */
+    int32 AwakeSprings = 0;
+
+    /** Bytes allocated by the spring pool, including chunk slack */
+    SIZE_T SpringAllocatedBytes = 0;
+};
+
+UCLASS(Config = NsTween)
+class NSTWEEN_API UNsTweenSubsystem : public UGameInstanceSubsystem
 {
     GENERATED_BODY()
 
@@ -37,14 +114,96 @@ public:
 
     /** Queue API */
     FNsTweenHandle EnqueueSpawn(const FNsTweenSpec& Spec, const TSharedPtr<ITweenValue>& Strategy);
+    FNsTweenHandle EnqueueSpawn(FNsTweenSpec&& Spec, TSharedPtr<ITweenValue> Strategy);
+
+    /** Direct spawn API: reserve a pooled record, construct its strategy in place, then start it with the moved spec */
+    FNsTweenColdData* ReserveTween();
+    FNsTweenHandle EnqueueSpawn(const FNsTweenHandle& ReservedHandle, FNsTweenSpec&& Spec);
+
+    /** Returns a reserved record to the pool without starting it, for builders whose tween will never play */
+    void DiscardReserved(const FNsTweenHandle& ReservedHandle);
+
+    /** Synchronous spawn: on the game thread the tween joins the live pool with its start value applied; elsewhere it is queued */
+    FNsTweenHandle SpawnImmediate(const FNsTweenHandle& ReservedHandle, FNsTweenSpec&& Spec);
+    FNsTweenHandle SpawnImmediate(FNsTweenSpec&& Spec, TSharedPtr<ITweenValue> Strategy);
+
+    /** Chaining API: start a tween once Predecessor completes, inside the same tick with the leftover time */
+    FNsTweenHandle SpawnAfter(const FNsTweenHandle& Predecessor, const FNsTweenHandle& ReservedHandle, FNsTweenSpec&& Spec);
+    FNsTweenHandle SpawnAfter(const FNsTweenHandle& Predecessor, FNsTweenSpec&& Spec, TSharedPtr<ITweenValue> Strategy);
+
     void EnqueueCancel(const FNsTweenHandle& Handle, bool bApplyFinal);
     void EnqueuePause(const FNsTweenHandle& Handle);
     void EnqueueResume(const FNsTweenHandle& Handle);
+
+    /** Live updates: change a running or chained tween in place on the next tick, without respawning it */
+    void EnqueueSetTimeScale(const FNsTweenHandle& Handle, float TimeScale);
+    void EnqueueSetDuration(const FNsTweenHandle& Handle, float DurationSeconds);
+    void EnqueueSetEasing(const FNsTweenHandle& Handle, const FNsTweenSpec& Easing);
+    void EnqueueSetEndValue(const FNsTweenHandle& Handle, const FNsTweenValue& EndValue, bool bVelocityContinuous);
     bool IsActive(const FNsTweenHandle& Handle) const;
 
+    /** Compact API (game thread): fire-and-forget float tweens writing into registered float blocks */
+    int32 RegisterCompactTargets(TArrayView<float> Values, FNsTweenCompactComplete OnComplete = FNsTweenCompactComplete());
+    void UnregisterCompactTargets(int32 BlockId);
+    bool SpawnCompactTween(int32 BlockId, int32 TargetIndex, float StartValue, float EndValue, float DurationSeconds, ENsTweenEase Ease, ENsTweenCompactFlags Flags = ENsTweenCompactFlags::None);
+
+    /** Shared clocks (game thread): tweens whose spec names a clock take their timing from it instead of their own */
+    FNsTweenClockHandle CreateClock(const FNsTweenSpec& Timing);
+    void ReleaseClock(const FNsTweenClockHandle& Clock);
+    void SetClockPaused(const FNsTweenClockHandle& Clock, bool bPaused);
+    void SeekClock(const FNsTweenClockHandle& Clock, float CycleSeconds);
+    const FNsTweenClock* FindClock(const FNsTweenClockHandle& Clock) const;
+
+    /** Springs (game thread): values following a moving target with damped spring motion, asleep once settled */
+    template <typename TValue>
+    FNsTweenSpringHandle CreateSpring(const TValue& Initial, const FNsTweenSpringSpec& Spec, TFunction<void(const TValue&)> Update)
+    {
+        using FChannels = TNsTweenSpringChannels<TValue>;
+        double Channels[FChannels::Num];
+        FChannels::ToChannels(Initial, Channels);
+        const FNsTweenSpringHandle Spring = SpringPool.Create(FChannels::Num, Channels, Spec, [Update = MoveTemp(Update)](const double* Values)
+        {
+            Update(FChannels::FromChannels(Values));
+        });
+        WakeTicker();
+        return Spring;
+    }
+
+    template <typename TValue>
+    bool SetSpringTarget(const FNsTweenSpringHandle& Spring, const TValue& Target)
+    {
+        using FChannels = TNsTweenSpringChannels<TValue>;
+        double Channels[FChannels::Num];
+        FChannels::ToChannels(Target, Channels);
+        const bool bSet = SpringPool.SetTarget(Spring, FChannels::Num, Channels);
+        if (bSet)
+        {
+            WakeTicker();
+        }
+        return bSet;
+    }
+
+    void ReleaseSpring(const FNsTweenSpringHandle& Spring);
+
+    /** Component transform writes gathered during the tick and applied once per component (game thread) */
+    FNsTweenTransformBatcher& GetTransformBatcher() { return TransformBatcher; }
+
+    /** Material parameter writes gathered during the tick and applied grouped by instance (game thread) */
+    FNsTweenMaterialBatcher& GetMaterialBatcher() { return MaterialBatcher; }
+
+    /** UMG widget writes gathered during the tick and applied once per widget (game thread) */
+    FNsTweenWidgetBatcher& GetWidgetBatcher() { return WidgetBatcher; }
+
+    /** Instanced static mesh writes gathered during the tick and submitted once per component (game thread) */
+    FNsTweenInstanceBatcher& GetInstanceBatcher() { return InstanceBatcher; }
+
     /** Stop everything now (used by teardown/PIE end) */
     void StopAllTweens(bool bApplyFinalOnCancel);
 
+    /** Memory report */
+    FNsTweenMemoryStats GetMemoryStats() const;
+    void LogMemoryStats() const;
+
     /** Get Subsystem */
     static UNsTweenSubsystem* GetSubsystem();
 
@@ -59,13 +218,72 @@ private:
     void CancelTween(const FNsTweenCommand& Command);
     void PauseTween(const FNsTweenCommand& Command);
     void ResumeTween(const FNsTweenCommand& Command);
+    void UpdateTween(const FNsTweenCommand& Command);
+
+    /** Returns the live or chained tween with the given handle, or nullptr (caller holds PoolLock) */
+    FNsTween* FindTween(const FNsTweenHandle& Handle);
+
+    /** Returns the running hot record of a handle through its cold record's LiveIndex, or nullptr (caller holds PoolLock) */
+    FNsTween* FindLiveTween(const FNsTweenHandle& Handle);
+    const FNsTween* FindLiveTween(const FNsTweenHandle& Handle) const;
+
+    /** Returns the normalized time of a running tween, read from its clock when it has one */
+    float GetLinearAlpha(const FNsTween& Instance) const;
+
+    /** Live pool upkeep that keeps each cold record's LiveIndex current (caller holds PoolLock) */
+    void AddLive(const FNsTween& Instance);
+    void RemoveLiveAtSwap(int32 Index);
+
+    /** Returns the running hot record of a cold record in O(1), or nullptr (caller holds PoolLock) */
+    FNsTween* FindLive(const FNsTweenColdData& Record);
+
+    /**
+     * Resolves a tween about to join the live pool against the tween driving its target, per its overwrite policy.
+     * Returns false when the tween was queued behind the running one instead (game thread)
+     */
+    bool ClaimTarget(FNsTween& Incoming);
+
+    /** Starts a record, applies its start value and inserts it into the live pool (game thread) */
+    FNsTweenHandle InsertImmediate(FNsTweenColdData& Record, FNsTweenSpec&& Spec);
+
+    /** Chained successors */
+    FNsTweenHandle LinkTween(const FNsTweenHandle& Predecessor, FNsTweenColdData& Record, FNsTweenSpec&& Spec);
+    void StartSuccessors(const FNsTweenHandle& Predecessor, float LeftoverSeconds);
+    void DropSuccessors(const FNsTweenHandle& Predecessor);
+
+    /** Removes a record from the reserved list, or returns nullptr when no builder reserved it (caller holds PoolLock) */
+    FNsTweenColdData* TakeReservedRecord(const FNsTweenHandle& ReservedHandle);
+
+    /** Advances every live clock once, before the tweens attached to them tick */
+    void AdvanceClocks(float DeltaTime);
+
+    /** Applies the writes gathered by the component, material and widget batchers */
+    void FlushBatchers();
 
     /** Easing factory */
     TSharedPtr<IEasingCurve> CreateEasing(const FNsTweenSpec& Spec) const;
 
+    /** Record pool */
+    FNsTweenColdData* AcquireRecord(const FNsTweenHandle& Handle);
+    void ReleaseRecords(TArrayView<FNsTweenColdData* const> Records);
+
+    /** Adds a record to the side table, or frees one from it (caller holds PoolLock) */
+    FNsTweenColdData* AllocateRecord();
+    void DiscardRecord(FNsTweenColdData& Record);
+    FNsTweenHandle AllocateHandle();
+
     /** Are we allowed to tick right now? */
     bool ShouldTick() const;
 
+    /**
+     * Idle sleep: the core ticker is registered by the first spawn, command, compact tween, spring or clock and drops
+     * itself once none is left, so idle frames cost nothing. WakeTicker is callable from any thread but never while
+     * holding PoolLock; SleepTicker runs from the tick (game thread) and returns the tick's keep-ticking result
+     */
+    void WakeTicker();
+    bool SleepTicker();
+    bool IsIdle() const;
+
     /** Clear any queued-but-unprocessed commands */
     void DrainCommandQueue();
 
@@ -81,8 +299,82 @@ private:
 // Components
 private:
 
-    /** Live tweens */
-    TArray<TUniquePtr<FNsTween>> TweenPool;
+    /** Number of tween records allocated up front and kept for reuse */
+    UPROPERTY(Config)
+    int32 PreallocatedTweens = 64;
+
+    /** Idle tween records kept for reuse; records released beyond it are freed, so a burst does not pin its memory */
+    UPROPERTY(Config)
+    int32 MaxFreeTweens = 4096;
+
+    /** Live tweens, packed hot records ticked front to back */
+    TArray<FNsTween> TweenPool;
+
+    /** Cold side table owning every config/callback record; records never move, their owning slots may */
+    TArray<TUniquePtr<FNsTweenColdData>> ColdTable;
+
+    /** Idle cold records ready to be reserved (guarded by PoolLock) */
+    TArray<FNsTweenColdData*> FreeTweens;
+
+    /** Cold records handed to builders that are still being configured (guarded by PoolLock) */
+    TArray<FNsTweenColdData*> ReservedTweens;
+
+    /** Recycle counters reported by GetMemoryStats (guarded by PoolLock) */
+    int64 RecycledRecords = 0;
+    int64 AllocatedRecords = 0;
+    int64 DiscardedRecords = 0;
+
+    /** Started tweens waiting to join the live pool on the next command pump (guarded by PoolLock) */
+    TArray<FNsTween> PendingTweens;
+
+    /** Started tweens waiting for their predecessor to complete, keyed by the predecessor's id (guarded by PoolLock) */
+    TMap<FNsTweenId, TArray<FNsTween, TInlineAllocator<1>>> Successors;
+
+    /** Cold record of every reserved, pending, linked or live tween by handle, so commands find it without a scan (guarded by PoolLock) */
+    TMap<FNsTweenId, FNsTweenColdData*> RecordsByHandle;
+
+    /** Record of the tween driving each target, so a new tween on it finds the old one without a scan (guarded by PoolLock) */
+    TMap<FNsTweenTargetKey, FNsTweenColdData*> Targets;
+
+    /** Slot of the clock table */
+    struct FClockSlot
+    {
+        /** Shared playback state */
+        FNsTweenClock Clock;
+
+        /** Generation, bumped on release so stale handles stop resolving */
+        uint16 Serial = 0;
+
+        /** True between CreateClock and ReleaseClock */
+        bool bInUse = false;
+    };
+
+    /** Shared clocks; slot indices are stable and recycled through FreeClocks */
+    TArray<FClockSlot> Clocks;
+
+    /** Clock slots available for reuse */
+    TArray<int16> FreeClocks;
+
+    /** True while live tweens are being ticked; TweenPool must not be restructured then */
+    bool bTickingTweens = false;
+
+    /** Fixed-size float tweens for massive counts */
+    FNsTweenCompactPool CompactPool;
+
+    /** Spring-driven values; only awake springs are stepped */
+    FNsTweenSpringPool SpringPool;
+
+    /** Per-component transform accumulation flushed at the end of each tick */
+    FNsTweenTransformBatcher TransformBatcher;
+
+    /** Per-instance material parameter accumulation flushed at the end of each tick */
+    FNsTweenMaterialBatcher MaterialBatcher;
+
+    /** Per-widget render transform, opacity and color accumulation flushed at the end of each tick */
+    FNsTweenWidgetBatcher WidgetBatcher;
+
+    /** Per-component instance transform and custom data accumulation flushed at the end of each tick */
+    FNsTweenInstanceBatcher InstanceBatcher;
 
     /** Command queue (game thread) */
     TQueue<FNsTweenCommand, EQueueMode::Mpsc> CommandQueue;
@@ -94,9 +386,18 @@ private:
     friend struct FNsTweenSubsystemTestAccessor;
 #endif
 
-    /** Main ticker handle */
+    /** Main ticker handle, valid while the ticker is registered (guarded by TickerLock) */
     FTSTicker::FDelegateHandle TickerHandle;
 
+    /** Serializes ticker registration between wakes from any thread and the tick going to sleep */
+    FCriticalSection TickerLock;
+
+    /** True while the ticker is registered; read without the lock so wakes on a running ticker stay cheap */
+    std::atomic<bool> bTickerAwake = false;
+
+    /** True between Initialize and Deinitialize, so late wakes do not register a ticker (guarded by TickerLock) */
+    bool bTickerEnabled = false;
+
     /** ID allocator */
     FThreadSafeCounter NextTweenId;
 
@@ -114,6 +415,33 @@ struct FNsTweenSubsystemTestAccessor
     {
         return Subsystem.CommandQueue.Dequeue(OutCommand);
     }
+
+    static int32 NumPendingTweens(const UNsTweenSubsystem& Subsystem)
+    {
+        FReadScopeLock ReadLock(Subsystem.PoolLock);
+        return Subsystem.PendingTweens.Num();
+    }
+
+    static int32 NumHandleRecords(const UNsTweenSubsystem& Subsystem)
+    {
+        FReadScopeLock ReadLock(Subsystem.PoolLock);
+        return Subsystem.RecordsByHandle.Num();
+    }
+
+    static void ProcessCommands(UNsTweenSubsystem& Subsystem)
+    {
+        Subsystem.ProcessCommands();
+    }
+
+    static bool IsIdle(const UNsTweenSubsystem& Subsystem)
+    {
+        return Subsystem.IsIdle();
+    }
+
+    static bool IsTickerAwake(const UNsTweenSubsystem& Subsystem)
+    {
+        return Subsystem.bTickerAwake;
+    }
 };
 #endif
 
@@ -6,9 +6,12 @@
 #include "Interfaces/ITweenValue.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Curves/CurveFloat.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/WeakObjectPtr.h"
 #include "NsTweenTypeLibrary.generated.h"
 
+class FNsTweenCompiledSequence;
+
 /** Delegate fired every tick of a tween with the normalized alpha. */
 DECLARE_DELEGATE_OneParam(FNsTweenOnUpdate, float /*NormalizedAlpha*/);
 
@@ -27,7 +30,11 @@ enum class ENsTweenCommandType : uint8
     Spawn,
     Cancel,
     Pause,
-    Resume
+    Resume,
+    SetTimeScale,
+    SetDuration,
+    SetEasing,
+    SetEndValue
 };
 
 /** Direction in which the tween should initially play. */
@@ -47,6 +54,40 @@ enum class ENsTweenWrapMode : uint8
     PingPong
 };
 
+/** Interpolation used when tweening rotations. */
+UENUM(BlueprintType)
+enum class ENsTweenRotationMode : uint8
+{
+    /** Constant angular velocity along the shortest arc. */
+    Slerp,
+    /** Normalized quaternion lerp; cheaper, slightly uneven speed on wide arcs. */
+    Nlerp,
+    /** Per-axis euler lerp taking the shortest way around each axis. */
+    ShortestEuler
+};
+
+/** Color space used when tweening colors. */
+UENUM(BlueprintType)
+enum class ENsTweenColorMode : uint8
+{
+    /** Component-wise lerp of the linear color. */
+    RGB,
+    /** Hue/saturation/value lerp taking the shortest hue path. */
+    HSV,
+    /** Perceptually uniform lerp through the OkLab space. */
+    OkLab
+};
+
+/** Space in which component transform tweens write their values. */
+UENUM(BlueprintType)
+enum class ENsTweenTransformSpace : uint8
+{
+    /** Relative to the attach parent, as RelativeLocation/RelativeRotation/RelativeScale3D. */
+    Relative,
+    /** World space, as SetWorldTransform. */
+    World
+};
+
 /** Easing presets that can be applied to tweens. */
 UENUM(BlueprintType)
 enum class ENsTweenEase : uint8
@@ -86,6 +127,55 @@ enum class ENsTweenEase : uint8
     CurveAsset
 };
 
+/** How a tween starting on a target that another tween drives resolves the conflict. */
+UENUM(BlueprintType)
+enum class ENsTweenOverwrite : uint8
+{
+    /** The running tween stops where it is and the new one takes over. */
+    Kill,
+    /** The new tween starts from the value the running one reached, then the running one stops; strategies that cannot hand over their value fall back to Kill. */
+    Blend,
+    /** The new tween waits for the running one to complete and starts with its leftover time. */
+    Queue
+};
+
+/** Identifies what a tween drives, an object and one of its properties or channels, so tweens on it can supersede each other. */
+struct FNsTweenTargetKey
+{
+    /** Object written by the tween. */
+    FObjectKey Object;
+
+    /** Property or channel of the object; tweens on different channels of the same object do not conflict. */
+    FName Channel;
+
+    /** Returns true when the key names a target. */
+    bool IsValid() const { return Object != FObjectKey(); }
+
+    bool operator==(const FNsTweenTargetKey& Other) const { return Object == Other.Object && Channel == Other.Channel; }
+    bool operator!=(const FNsTweenTargetKey& Other) const { return !(*this == Other); }
+
+    friend uint32 GetTypeHash(const FNsTweenTargetKey& Key)
+    {
+        return HashCombine(GetTypeHash(Key.Object), GetTypeHash(Key.Channel));
+    }
+};
+
+/** Identifies a shared clock created by UNsTweenSubsystem::CreateClock; packed to fit the hot tween record. */
+struct FNsTweenClockHandle
+{
+    /** Slot of the clock in the subsystem's clock table. */
+    int16 Index = INDEX_NONE;
+
+    /** Generation of the slot, so handles to a released clock stay detectably stale. */
+    uint16 Serial = 0;
+
+    /** Returns true when the handle references a clock. */
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    /** Resets the handle so the tween runs on its own timing. */
+    void Reset() { Index = INDEX_NONE; Serial = 0; }
+};
+
 /** Describes the configuration required to spawn a tween. */
 USTRUCT(BlueprintType)
 struct NSTWEEN_API FNsTweenSpec
@@ -129,6 +219,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
     TWeakObjectPtr<UCurveFloat> CurveAsset = nullptr;
 
+    /** Interpolation used by rotation, quaternion and transform tweens. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    ENsTweenRotationMode RotationMode = ENsTweenRotationMode::Slerp;
+
+    /** Color space used by color tweens. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    ENsTweenColorMode ColorMode = ENsTweenColorMode::RGB;
+
     /** Callback executed every tick of the tween. */
     FNsTweenOnUpdate OnUpdate;
 
@@ -150,6 +248,48 @@ public:
 
     /** Internal flag set when the owner lifetime should be enforced. */
     bool bEnforceOwnerLifetime = false;
+
+    /** Shared clock driving the tween; when set, the clock's timing replaces duration, delay, time scale and wrap mode. */
+    FNsTweenClockHandle Clock;
+
+    /** Target the tween drives; when valid, a tween already running on it is resolved through Overwrite. */
+    FNsTweenTargetKey Target;
+
+    /** What happens to a tween already driving Target when this one starts. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    ENsTweenOverwrite Overwrite = ENsTweenOverwrite::Kill;
+};
+
+/** How component transform tweens move their component when the batched writes are flushed. */
+USTRUCT(BlueprintType)
+struct NSTWEEN_API FNsTweenMoveOptions
+{
+    GENERATED_BODY()
+
+public:
+    /** Space the tweened location, rotation and scale are expressed in. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    ENsTweenTransformSpace Space = ENsTweenTransformSpace::Relative;
+
+    /** Sweep the component to the new location, stopping at blocking hits. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    bool bSweep = false;
+
+    /** Teleport physics state instead of deriving velocity from the move. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    bool bTeleport = false;
+
+    /**
+     * Layers the tween on top of the other tweens driving the component instead of replacing their value. Start and
+     * end are offsets; every layer's offset is summed into a single move per frame, and the end offset is kept once
+     * the tween completes.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    bool bAdditive = false;
+
+    /** Scales the offset of an additive tween, to mix layers or fade one in. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween", meta = (EditCondition = "bAdditive"))
+    float Weight = 1.f;
 };
 
 /** A single entry within a tween sequence asset. */
@@ -162,6 +302,10 @@ public:
     /** Specification describing the tween contained in this entry. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
     FNsTweenSpec Spec;
+
+    /** Items sharing a track play one after another; different tracks play in parallel. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
+    int32 Track = 0;
 };
 
 /** UObject wrapper for configuring tween sequences. */
@@ -171,9 +315,27 @@ class NSTWEEN_API UNsTweenSequence : public UObject
     GENERATED_BODY()
 
 public:
-    /** Collection of sequence items executed sequentially. */
+    /** Returns the flat timeline of the items, compiled on first use or loaded with the asset, and shared by every player. */
+    TSharedRef<const FNsTweenCompiledSequence> GetCompiled() const;
+
+    /** Drops the compiled timeline so the next player recompiles it; call after editing Items at runtime. */
+    void InvalidateCompiled() { Compiled.Reset(); }
+
+    /** Saves the compiled timeline with the asset; cooked builds load it instead of compiling Items. */
+    virtual void Serialize(FArchive& Ar) override;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+public:
+    /** Collection of sequence items, laid out per track. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween")
     TArray<FNsTweenSequenceItem> Items;
+
+private:
+    /** Compiled timeline; running players keep the one they started with. */
+    mutable TSharedPtr<const FNsTweenCompiledSequence> Compiled;
 };
 
 /** Identifier assigned to spawned tweens. */
@@ -198,6 +360,9 @@ public:
 
     /** Compares two identifiers for inequality. */
     bool operator!=(const FNsTweenId& Other) const { return !(*this == Other); }
+
+    /** Hashes the identifier so it can key maps directly. */
+    friend uint32 GetTypeHash(const FNsTweenId& Id) { return ::GetTypeHash(Id.Value); }
 };
 
 /** Handle returned to callers when a tween is spawned. */
@@ -227,14 +392,20 @@ struct FNsTweenCommand
     /** Handle used to identify the target tween. */
     FNsTweenHandle Handle;
 
-    /** Specification payload associated with the command. */
+    /** Specification payload associated with the command; also carries the time scale, duration or easing of updates. */
     FNsTweenSpec Spec;
 
     /** Strategy factory used when spawning tweens. */
     TSharedPtr<ITweenValue> Strategy;
 
+    /** End value moved to by SetEndValue commands; kept out of line so other commands stay small. */
+    TSharedPtr<const FNsTweenValue> EndValue;
+
     /** Tracks whether the final value should be applied on cancel. */
     bool bApplyFinalOnCancel = true;
+
+    /** Keeps the value's rate of change continuous when the end value moves. */
+    bool bVelocityContinuous = false;
 };
 
 /** Blueprint function library that exposes NsTween helpers. */
@@ -0,0 +1,107 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class ITweenValue;
+class UScriptStruct;
+
+/** How a single channel of a property plan is blended and written. */
+enum class ENsTweenPropertyChannelKind : uint8
+{
+    Float,
+    Double,
+    Quat,
+    Rotator,
+};
+
+/** One blended field of a property plan, relative to the start of the tweened value. */
+struct FNsTweenPropertyChannel
+{
+    /** Byte offset of the field inside the tweened value. */
+    int32 Offset = 0;
+
+    /** Representation of the field. */
+    ENsTweenPropertyChannelKind Kind = ENsTweenPropertyChannelKind::Float;
+};
+
+/**
+ * Property path resolved once into a base offset and a list of typed channels.
+ * Scalars resolve to one channel; structs expand field by field, with quaternions and rotators kept whole so they
+ * blend along the shortest rotation.
+ */
+struct NSTWEEN_API FNsTweenPropertyPlan
+{
+public:
+    /** Largest tweened value supported, sized for FTransform. */
+    static constexpr int32 MaxValueSize = 96;
+
+    /**
+     * Resolves a dot-separated path such as "RelativeLocation.Z" against a class or struct.
+     * Pass nullptr as ValueStruct to resolve a float or double leaf, or the struct type the leaf must have.
+     */
+    bool Resolve(const UStruct* OwnerStruct, const FString& Path, const UScriptStruct* ValueStruct, FString* OutError = nullptr);
+
+    /** Blends two values laid out as the leaf type and writes the result over the leaf at Dest. */
+    void Blend(const uint8* A, const uint8* B, float Alpha, uint8* Dest) const;
+
+    /** Copies the planned fields of a value laid out as the leaf type over the leaf at Dest. */
+    void Copy(const uint8* Source, uint8* Dest) const;
+
+    /** Writes a scalar into a buffer laid out as the (scalar) leaf type. */
+    void StoreScalar(double Value, uint8* Dest) const;
+
+    /** Returns true once the plan resolved successfully. */
+    bool IsValid() const { return Channels.Num() > 0; }
+
+public:
+    /** Offset of the leaf value from the start of the owning object. */
+    int32 BaseOffset = 0;
+
+    /** Size of the leaf value in bytes. */
+    int32 ValueSize = 0;
+
+    /** Fields blended by the plan. */
+    TArray<FNsTweenPropertyChannel, TInlineAllocator<8>> Channels;
+
+private:
+    /** Appends the blendable fields of a struct starting at Offset. */
+    void AddStructChannels(const UScriptStruct* Struct, int32 Offset);
+};
+
+/**
+ * Owner shared by every property tween driving the same object.
+ * The weak pointer is resolved at most once per frame and garbage collection: a collection can run mid-frame, after the
+ * core ticker and before Slate, so the cached pointer is dropped when one completes and strategies applied later in
+ * the frame resolve again.
+ */
+struct NSTWEEN_API FNsTweenPropertyOwner
+{
+public:
+    /** Returns the shared owner record for an object, creating it on first use. Game thread only. */
+    static TSharedRef<FNsTweenPropertyOwner> FindOrAdd(UObject* Object);
+
+    /** Returns the owner if it is still alive this frame. */
+    UObject* Get();
+
+private:
+    /** Object driven by the tweens. */
+    TWeakObjectPtr<UObject> Object;
+
+    /** Pointer cached by the last validation. */
+    UObject* Resolved = nullptr;
+
+    /** Frame the cached pointer was validated on. */
+    uint64 ValidatedFrame = MAX_uint64;
+
+    /** Garbage collections completed when the cached pointer was validated. */
+    uint32 ValidatedCollection = 0;
+};
+
+/** Builds a strategy that drives a float or double property of Target; returns nullptr when the path does not resolve. */
+NSTWEEN_API TSharedPtr<ITweenValue> MakeNsTweenPropertyStrategy(UObject* Target, const FString& PropertyPath, double StartValue, double EndValue);
+
+/** Builds a strategy that drives a struct property of Target field by field; Start and End must point at ValueStruct instances. */
+NSTWEEN_API TSharedPtr<ITweenValue> MakeNsTweenPropertyStrategy(UObject* Target, const FString& PropertyPath, const UScriptStruct* ValueStruct, const void* StartValue, const void* EndValue);
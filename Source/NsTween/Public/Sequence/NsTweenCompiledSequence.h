@@ -0,0 +1,114 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NsTweenTypeLibrary.h"
+
+/** One item of a compiled sequence, placed on its track's timeline. */
+struct FNsTweenSequenceSegment
+{
+    /** Sequence time the item starts moving, after its delay. */
+    float StartTime = 0.f;
+
+    /** Sequence time the item's last cycle ends. */
+    float EndTime = 0.f;
+
+    /** Length of one cycle in sequence time, with the item's time scale applied. */
+    float CycleDuration = 0.f;
+
+    /** Index of the item in the source asset, and of its binding. */
+    int32 Item = INDEX_NONE;
+
+    /** Cycles played; a ping-pong pair counts as two. */
+    int32 Cycles = 1;
+
+    /** First baked easing sample, or INDEX_NONE when Ease is a polynomial preset evaluated directly. */
+    int32 SampleOffset = INDEX_NONE;
+
+    /** Easing preset of the item. */
+    ENsTweenEase Ease = ENsTweenEase::Linear;
+
+    /** How the item repeats. */
+    ENsTweenWrapMode WrapMode = ENsTweenWrapMode::Once;
+
+    /** Direction of the item's first cycle. */
+    ENsTweenDirection Direction = ENsTweenDirection::Forward;
+
+    /** Rotation interpolation the item's binding is prepared with. */
+    ENsTweenRotationMode RotationMode = ENsTweenRotationMode::Slerp;
+
+    /** Color space the item's binding is prepared with. */
+    ENsTweenColorMode ColorMode = ENsTweenColorMode::RGB;
+};
+
+/** Contiguous range of segments played one after another. */
+struct FNsTweenSequenceTrack
+{
+    /** First segment of the track. */
+    int32 FirstSegment = 0;
+
+    /** Number of segments on the track. */
+    int32 NumSegments = 0;
+};
+
+/**
+ * Flat timeline of a UNsTweenSequence: every item becomes a segment with an absolute start offset, duration and
+ * easing, grouped by track. Items sharing a track play back to back in authoring order; tracks play in parallel.
+ * The active segment of a track is found by binary search on the start offsets.
+ * The timeline is plain data: polynomial easings are stored as preset ids and bezier and curve asset easings are
+ * baked into samples, so it serializes as a blob with the asset and needs no spec or curve at runtime. Immutable
+ * once compiled, so every player of an asset shares one instance.
+ */
+class NSTWEEN_API FNsTweenCompiledSequence
+{
+public:
+    /** Samples baked per bezier or curve asset easing. */
+    static constexpr int32 BakedSamples = 64;
+
+    /**
+     * Lays out the items on their tracks. Loop and ping-pong items must be finite to be placed; items that repeat
+     * forever play one loop or one ping-pong pair.
+     */
+    static TSharedRef<FNsTweenCompiledSequence> Compile(TConstArrayView<FNsTweenSequenceItem> Items);
+
+    /** Reads or writes the timeline. */
+    void Serialize(FArchive& Ar);
+
+    /** Returns the last segment of a track that has started at Time, or INDEX_NONE before the first one. */
+    int32 FindSegment(int32 TrackIndex, float Time) const;
+
+    /** Returns the eased alpha of a segment at sequence time Time, clamped to the segment. */
+    float EvaluateSegment(int32 SegmentIndex, float Time) const;
+
+    /** Length of the whole sequence. */
+    float GetDuration() const { return Duration; }
+
+    /** Number of items in the source asset. */
+    int32 NumItems() const { return ItemCount; }
+
+    /** Tracks, in ascending track number. */
+    const TArray<FNsTweenSequenceTrack>& GetTracks() const { return Tracks; }
+
+    /** Builds the spec a segment's binding is prepared with; only the interpolation modes are set. */
+    FNsTweenSpec MakeBindingSpec(int32 SegmentIndex) const;
+
+    /** Returns one segment. */
+    const FNsTweenSequenceSegment& GetSegment(int32 SegmentIndex) const { return Segments[SegmentIndex]; }
+
+private:
+    /** Segments of every track, each track sorted by start time. */
+    TArray<FNsTweenSequenceSegment> Segments;
+
+    /** Track ranges within Segments. */
+    TArray<FNsTweenSequenceTrack> Tracks;
+
+    /** Baked easing samples of bezier and curve asset items, BakedSamples per item. */
+    TArray<float> Samples;
+
+    /** Length of the whole sequence. */
+    float Duration = 0.f;
+
+    /** Number of items in the source asset. */
+    int32 ItemCount = 0;
+};
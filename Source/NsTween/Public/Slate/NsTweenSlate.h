@@ -0,0 +1,56 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "Batching/NsTweenWidgetBatcher.h"
+#include "CoreMinimal.h"
+#include "NsTweenTypeLibrary.h"
+
+class SWidget;
+
+/**
+ * Tweens for raw Slate widgets, independent of the tween subsystem and of any game world.
+ * Each animated widget gets a runner driven by an active timer on that widget: the timer is registered when the
+ * first tween starts and unregistered when the last one ends, so idle UI costs nothing and no global ticker is kept
+ * alive. Tweens use the same spec, easing and playback rules as subsystem tweens; render transform channels start
+ * from identity, and every channel written in a frame is applied to the widget once.
+ * Handles are only meaningful together with their widget. Slate thread only.
+ */
+class NSTWEEN_API FNsTweenSlate
+{
+public:
+    /** Plays a tween on the selected render transform and opacity channels of a widget. */
+    static FNsTweenHandle Play(const TSharedRef<SWidget>& Widget, ENsTweenWidgetChannel Channels, const FNsTweenWidgetState& StartValue, const FNsTweenWidgetState& EndValue, const FNsTweenSpec& Spec);
+
+    /** Plays a color tween on any widget with a SetColorAndOpacity setter (SImage, STextBlock, SBorder, SCompoundWidget...). */
+    template <typename TWidget>
+    static FNsTweenHandle PlayColor(const TSharedRef<TWidget>& Widget, const FLinearColor& StartValue, const FLinearColor& EndValue, const FNsTweenSpec& Spec)
+    {
+        SetColorSetter(Widget, [WeakWidget = TWeakPtr<TWidget>(Widget)](const FLinearColor& Color)
+        {
+            if (const TSharedPtr<TWidget> Pinned = WeakWidget.Pin())
+            {
+                Pinned->SetColorAndOpacity(Color);
+            }
+        });
+
+        FNsTweenWidgetState Start;
+        FNsTweenWidgetState End;
+        Start.Color = StartValue;
+        End.Color = EndValue;
+        return Play(Widget, ENsTweenWidgetChannel::Color, Start, End, Spec);
+    }
+
+    /** Cancels a tween on a widget, optionally applying its final value. */
+    static void Cancel(const TSharedRef<SWidget>& Widget, const FNsTweenHandle& Handle, bool bApplyFinal = true);
+
+    /** Cancels every tween on a widget, optionally applying their final values. */
+    static void CancelAll(const TSharedRef<SWidget>& Widget, bool bApplyFinal = true);
+
+    /** Returns true while the tween is running on the widget. */
+    static bool IsActive(const TSharedRef<SWidget>& Widget, const FNsTweenHandle& Handle);
+
+private:
+    /** Sets how the widget's runner applies the color channel. */
+    static void SetColorSetter(const TSharedRef<SWidget>& Widget, TFunction<void(const FLinearColor&)> Setter);
+};
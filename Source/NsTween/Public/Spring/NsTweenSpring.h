@@ -0,0 +1,238 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Motion of a spring. */
+struct FNsTweenSpringSpec
+{
+    /** Natural frequency in Hz; higher values close in on the target faster. */
+    float Frequency = 2.f;
+
+    /** One is critically damped: the fastest approach without overshoot. Lower values overshoot, higher values creep in. */
+    float DampingRatio = 1.f;
+
+    /** Distance to the target under which a spring that has also slowed down snaps to it and sleeps. */
+    float SettleThreshold = 1.e-3f;
+};
+
+/** Identifies a spring created by UNsTweenSubsystem::CreateSpring. */
+struct FNsTweenSpringHandle
+{
+    /** Slot of the spring in the spring pool. */
+    int32 Index = INDEX_NONE;
+
+    /** Generation of the slot, so handles to a released spring stay detectably stale. */
+    uint32 Serial = 0;
+
+    /** Returns true when the handle references a spring. */
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    /** Resets the handle. */
+    void Reset() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/** Maps a spring value type onto the double channels the spring pool integrates. */
+template <typename TValue>
+struct TNsTweenSpringChannels;
+
+template <>
+struct TNsTweenSpringChannels<float>
+{
+    static constexpr int32 Num = 1;
+    static void ToChannels(float Value, double* Out) { Out[0] = Value; }
+    static float FromChannels(const double* In) { return static_cast<float>(In[0]); }
+};
+
+template <>
+struct TNsTweenSpringChannels<double>
+{
+    static constexpr int32 Num = 1;
+    static void ToChannels(double Value, double* Out) { Out[0] = Value; }
+    static double FromChannels(const double* In) { return In[0]; }
+};
+
+template <>
+struct TNsTweenSpringChannels<FVector2D>
+{
+    static constexpr int32 Num = 2;
+    static void ToChannels(const FVector2D& Value, double* Out) { Out[0] = Value.X; Out[1] = Value.Y; }
+    static FVector2D FromChannels(const double* In) { return FVector2D(In[0], In[1]); }
+};
+
+template <>
+struct TNsTweenSpringChannels<FVector>
+{
+    static constexpr int32 Num = 3;
+    static void ToChannels(const FVector& Value, double* Out) { Out[0] = Value.X; Out[1] = Value.Y; Out[2] = Value.Z; }
+    static FVector FromChannels(const double* In) { return FVector(In[0], In[1], In[2]); }
+};
+
+template <>
+struct TNsTweenSpringChannels<FLinearColor>
+{
+    static constexpr int32 Num = 4;
+    static void ToChannels(const FLinearColor& Value, double* Out) { Out[0] = Value.R; Out[1] = Value.G; Out[2] = Value.B; Out[3] = Value.A; }
+    static FLinearColor FromChannels(const double* In) { return FLinearColor(In[0], In[1], In[2], In[3]); }
+};
+
+/**
+ * Exact step of a damped spring over one frame, as coefficients mapping (offset from target, velocity) to their new
+ * values. The closed form holds for any delta time, so long frames neither overshoot nor blow up the way explicit
+ * integration does.
+ */
+struct NSTWEEN_API FNsTweenSpringStep
+{
+    /** New offset per unit of offset. */
+    double PosPos = 1.0;
+
+    /** New offset per unit of velocity. */
+    double PosVel = 0.0;
+
+    /** New velocity per unit of offset. */
+    double VelPos = 0.0;
+
+    /** New velocity per unit of velocity. */
+    double VelVel = 1.0;
+
+    /** Computes the step for an angular frequency in radians per second and a damping ratio. */
+    static FNsTweenSpringStep Make(float AngularFrequency, float DampingRatio, float DeltaSeconds);
+};
+
+/**
+ * Values that follow a target with damped spring motion, for follow-the-cursor and camera-lag style animation.
+ * Moving the target is an O(1) write that keeps the current velocity, so nothing restarts. Springs that settle snap
+ * onto their target and sleep, costing nothing until their target moves again. Records live in fixed-size chunks so
+ * callbacks can create and release springs while the pool ticks.
+ * Game thread only.
+ */
+class NSTWEEN_API FNsTweenSpringPool
+{
+public:
+    /** Springs per chunk. */
+    static constexpr int32 ChunkSize = 256;
+
+    /** Maximum number of channels of one spring. */
+    static constexpr int32 MaxChannels = 4;
+
+    /** Receives the spring's channels after every step. */
+    using FWriteFunction = TFunction<void(const double* /*Channels*/)>;
+
+public:
+    /** Creates a spring resting at Initial; it sleeps until its target is set. */
+    FNsTweenSpringHandle Create(int32 NumChannels, const double* Initial, const FNsTweenSpringSpec& Spec, FWriteFunction Write);
+
+    /** Stops a spring where it is; the handle goes stale. */
+    void Release(const FNsTweenSpringHandle& Spring);
+
+    /** Moves the target of a spring and wakes it; returns false for stale handles or a channel count mismatch. */
+    bool SetTarget(const FNsTweenSpringHandle& Spring, int32 NumChannels, const double* Target);
+
+    /** Copies the spring's current channels; returns false for stale handles or a channel count mismatch. */
+    bool GetValue(const FNsTweenSpringHandle& Spring, int32 NumChannels, double* OutChannels) const;
+
+    /** Returns true while the handle references a live spring. */
+    bool IsValid(const FNsTweenSpringHandle& Spring) const;
+
+    /** Steps every awake spring, puts settled ones to sleep and calls the write functions of those that moved. */
+    void Tick(float DeltaSeconds);
+
+    /** Releases every spring; chunks are kept. */
+    void Reset();
+
+    /** Releases every spring and frees every chunk. */
+    void Empty();
+
+    /** Number of live springs. */
+    int32 Num() const { return NumSprings; }
+
+    /** Number of springs that are still moving. */
+    int32 NumAwake() const { return Awake.Num(); }
+
+    /** Bytes held by chunks and bookkeeping. */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** State of one spring. */
+    struct FSpring
+    {
+        /** Current value per channel. */
+        double Value[MaxChannels] = {};
+
+        /** Current velocity per channel, in units per second. */
+        double Velocity[MaxChannels] = {};
+
+        /** Value the spring heads to. */
+        double Target[MaxChannels] = {};
+
+        /** Receives the value after each step. */
+        FWriteFunction Write;
+
+        /** Natural frequency in radians per second. */
+        float AngularFrequency = 0.f;
+
+        /** Damping ratio. */
+        float DampingRatio = 1.f;
+
+        /** Distance under which the spring settles. */
+        float SettleThreshold = 0.f;
+
+        /** Position in Awake, or INDEX_NONE while asleep. */
+        int32 AwakeIndex = INDEX_NONE;
+
+        /** Generation, bumped on release so stale handles stop resolving. */
+        uint32 Serial = 0;
+
+        /** Number of channels in use. */
+        uint8 NumChannels = 0;
+
+        /** True between Create and Release. */
+        bool bInUse = false;
+    };
+
+    /** Fixed block of springs; chunks never move once allocated. */
+    struct FChunk
+    {
+        FSpring Springs[ChunkSize];
+    };
+
+    /** Returns the spring at a slot index. */
+    FORCEINLINE FSpring& At(int32 Index) { return Chunks[Index / ChunkSize]->Springs[Index % ChunkSize]; }
+    FORCEINLINE const FSpring& At(int32 Index) const { return Chunks[Index / ChunkSize]->Springs[Index % ChunkSize]; }
+
+    /** Returns the live spring a handle references, or nullptr. */
+    FSpring* Find(const FNsTweenSpringHandle& Spring);
+    const FSpring* Find(const FNsTweenSpringHandle& Spring) const;
+
+    /** Removes a spring from the awake list. */
+    void Sleep(FSpring& Spring);
+
+    /** Frees a released slot for reuse. */
+    void FreeSlot(int32 Index);
+
+private:
+    /** Spring storage. */
+    TArray<TUniquePtr<FChunk>> Chunks;
+
+    /** Slots in use or freed; slots at or past this index have never been used. */
+    int32 NumSlots = 0;
+
+    /** Live springs. */
+    int32 NumSprings = 0;
+
+    /** Released slots available for reuse. */
+    TArray<int32> FreeSlots;
+
+    /** Slots of the springs that are still moving. */
+    TArray<int32> Awake;
+
+    /** Springs stepped this tick, as (slot, serial), whose write functions run once every spring has moved. */
+    TArray<TPair<int32, uint32>> Moved;
+
+    /** Slots released by write functions, freed once the write pass is over. */
+    TArray<int32> DeferredFrees;
+
+    /** True while write functions run; released slots are not reused then. */
+    bool bWriting = false;
+};
@@ -0,0 +1,55 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Templates/NsTweenInterpolator.h"
+
+/**
+ * Tween value strategy blending a whole caller-owned buffer between two snapshots.
+ * Every element shares the tween's alpha, so the blend runs as one uniform-alpha kernel pass over contiguous memory
+ * (see FNsTweenInterpolator::LerpBuffer). There is no per-frame callback; completion is reported through the spec.
+ * The target buffer must stay allocated, at the same address, until the tween completes or is cancelled.
+ */
+template <typename TValue>
+class TNsTweenBufferValue : public ITweenValue
+{
+public:
+    /** Constructs the strategy; both snapshots must have as many elements as the target buffer. */
+    TNsTweenBufferValue(TArrayView<TValue> InTarget, TArray<TValue> InStartValues, TArray<TValue> InEndValues)
+        : Target(InTarget)
+        , StartValues(MoveTemp(InStartValues))
+        , EndValues(MoveTemp(InEndValues))
+    {
+        check(StartValues.Num() == Target.Num() && EndValues.Num() == Target.Num());
+    }
+
+    /** Copies the start snapshot into the buffer. */
+    virtual void Initialize() override
+    {
+        CopyAssignItems(Target.GetData(), StartValues.GetData(), Target.Num());
+    }
+
+    /** Blends the whole buffer for the supplied eased alpha. */
+    virtual void Apply(float EasedAlpha) override
+    {
+        FNsTweenInterpolator<TValue>::LerpBuffer(StartValues.GetData(), EndValues.GetData(), EasedAlpha, Target.GetData(), Target.Num());
+    }
+
+    /** Copies the end snapshot into the buffer. */
+    virtual void ApplyFinal() override
+    {
+        CopyAssignItems(Target.GetData(), EndValues.GetData(), Target.Num());
+    }
+
+private:
+    /** Caller-owned buffer written every update. */
+    TArrayView<TValue> Target;
+
+    /** Snapshot at alpha 0. */
+    TArray<TValue> StartValues;
+
+    /** Snapshot at alpha 1. */
+    TArray<TValue> EndValues;
+};
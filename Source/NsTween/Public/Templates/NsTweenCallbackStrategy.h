@@ -6,27 +6,38 @@
 #include "Templates/NsTweenInterpolator.h"
 #include "Interfaces/ITweenValue.h"
 
-/** Tween value strategy that invokes a callback for each interpolation update. */
-template <typename TValue>
-class FNsTweenCallbackValue : public ITweenValue
+/**
+ * Tween value strategy that invokes a callback for each interpolation update.
+ * The callable is stored by value, so lambdas passed to FNsTween::Play live inline in the strategy without a TFunction allocation.
+ */
+template <typename TValue, typename TCallable = TFunction<void(const TValue&)>>
+class TNsTweenCallbackValue : public ITweenValue
 {
 public:
     /** Type alias describing the function executed when the tween updates. */
-    using FUpdateFunction = TFunction<void(const TValue&)>;
+    using FUpdateFunction = TCallable;
 
 public:
     /** Constructs the strategy with the provided start, end, and update callback. */
-    FNsTweenCallbackValue(const TValue& InStart, const TValue& InEnd, FUpdateFunction InUpdate)
+    template <typename TUpdate>
+    TNsTweenCallbackValue(const TValue& InStart, const TValue& InEnd, TUpdate&& InUpdate)
         : StartValue(InStart)
         , EndValue(InEnd)
-        , UpdateFunction(MoveTemp(InUpdate))
+        , VelocityOffset(ZeroOffset())
+        , UpdateFunction(Forward<TUpdate>(InUpdate))
     {
     }
 
+    /** Caches endpoint conversions for the spec's interpolation modes. */
+    virtual void Prepare(const FNsTweenSpec& Spec) override
+    {
+        FNsTweenInterpolator<TValue>::Prepare(Endpoints, StartValue, EndValue, Spec);
+    }
+
     /** Initializes the tween, applying the start value immediately. */
     virtual void Initialize() override
     {
-        if (UpdateFunction)
+        if (IsBound())
         {
             UpdateFunction(StartValue);
         }
@@ -35,37 +46,220 @@ public:
     /** Applies an interpolated value for the supplied eased alpha. */
     virtual void Apply(float EasedAlpha) override
     {
-        if (UpdateFunction)
+        if (IsBound())
         {
-            const TValue Interpolated = FNsTweenInterpolator<TValue>::Lerp(StartValue, EndValue, EasedAlpha);
-            UpdateFunction(Interpolated);
+            UpdateFunction(Sample(EasedAlpha));
         }
     }
 
     /** Applies the final value when the tween completes. */
     virtual void ApplyFinal() override
     {
-        if (UpdateFunction)
+        if (IsBound())
         {
             UpdateFunction(EndValue);
         }
     }
 
+    /**
+     * Restarts the curve from its value at EasedAlpha and heads to NewEnd over the remaining eased progress, so the
+     * easing carries on instead of starting over. With bVelocityContinuous, additive types (floats, vectors, linear
+     * colors) also keep their current rate of change; rotations and transforms keep their position only.
+     */
+    virtual bool SetEndValue(const FNsTweenValue& NewEnd, const FNsTweenSpec& Spec, float EasedAlpha, bool bVelocityContinuous) override
+    {
+        if constexpr (TNsTweenVariantHolds<TValue, FNsTweenValue>::Value)
+        {
+            const TValue* Target = NewEnd.template TryGet<TValue>();
+            if (!Target)
+            {
+                return false;
+            }
+
+            const float Remaining = 1.f - EasedAlpha;
+            if (FMath::Abs(Remaining) < KINDA_SMALL_NUMBER)
+            {
+                // No progress left to blend over: the end simply moves.
+                EndValue = *Target;
+                FNsTweenInterpolator<TValue>::Prepare(Endpoints, StartValue, EndValue, Spec);
+                return true;
+            }
+
+            const TValue Current = Sample(EasedAlpha);
+            FOffset Velocity = ZeroOffset();
+            if constexpr (bAdditive)
+            {
+                if (bVelocityContinuous)
+                {
+                    Velocity = (Sample(EasedAlpha + SlopeStep) - Sample(EasedAlpha - SlopeStep)) / (2.f * SlopeStep);
+                }
+            }
+
+            StartValue = Current;
+            EndValue = *Target;
+            AlphaOrigin = EasedAlpha;
+            AlphaScale = 1.f / Remaining;
+            VelocityOffset = ZeroOffset();
+            bRetargeted = true;
+            FNsTweenInterpolator<TValue>::Prepare(Endpoints, StartValue, EndValue, Spec);
+
+            if constexpr (bAdditive)
+            {
+                if (bVelocityContinuous)
+                {
+                    // The offset term is zero at both ends and its slope at the retarget point cancels the change in rate.
+                    const TValue NewSlope = (Sample(EasedAlpha + SlopeStep) - Current) / SlopeStep;
+                    VelocityOffset = (Velocity - NewSlope) * Remaining;
+                }
+            }
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /** Reports the value at EasedAlpha, so a tween superseding this one can start from it. */
+    virtual bool SampleValue(float EasedAlpha, FNsTweenValue& OutValue) const override
+    {
+        if constexpr (TNsTweenVariantHolds<TValue, FNsTweenValue>::Value)
+        {
+            OutValue.template Emplace<TValue>(Sample(EasedAlpha));
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /** Starts the curve from NewStart; any earlier retarget is dropped. */
+    virtual bool SetStartValue(const FNsTweenValue& NewStart, const FNsTweenSpec& Spec) override
+    {
+        if constexpr (TNsTweenVariantHolds<TValue, FNsTweenValue>::Value)
+        {
+            const TValue* Start = NewStart.template TryGet<TValue>();
+            if (!Start)
+            {
+                return false;
+            }
+
+            StartValue = *Start;
+            AlphaOrigin = 0.f;
+            AlphaScale = 1.f;
+            VelocityOffset = ZeroOffset();
+            bRetargeted = false;
+            FNsTweenInterpolator<TValue>::Prepare(Endpoints, StartValue, EndValue, Spec);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
 private:
+    /** Value types whose velocity can be matched with an additive offset. */
+    static constexpr bool bAdditive = std::is_same_v<TValue, float> || std::is_same_v<TValue, double> || std::is_same_v<TValue, FVector2D>
+        || std::is_same_v<TValue, FVector> || std::is_same_v<TValue, FLinearColor>;
+
+    /** Empty offset of the value types that cannot be offset. */
+    struct FNoOffset
+    {
+    };
+
+    /** Storage of the velocity offset; empty for rotations and transforms. */
+    using FOffset = std::conditional_t<bAdditive, TValue, FNoOffset>;
+
+    /** Eased-alpha step used to estimate the curve's slope when retargeting. */
+    static constexpr float SlopeStep = 1.e-3f;
+
+    /** Returns the zero offset of the value type. */
+    static FOffset ZeroOffset()
+    {
+        if constexpr (std::is_same_v<TValue, float> || std::is_same_v<TValue, double>)
+        {
+            return TValue(0);
+        }
+        else if constexpr (std::is_same_v<TValue, FLinearColor>)
+        {
+            return FLinearColor::Transparent;
+        }
+        else if constexpr (bAdditive)
+        {
+            return TValue::ZeroVector;
+        }
+        else
+        {
+            return FNoOffset();
+        }
+    }
+
+    /** Evaluates the curve, remapped onto the progress left when it was last retargeted. */
+    TValue Sample(float EasedAlpha) const
+    {
+        if (!bRetargeted)
+        {
+            return FNsTweenInterpolator<TValue>::Evaluate(Endpoints, StartValue, EndValue, EasedAlpha);
+        }
+
+        const float Alpha = (EasedAlpha - AlphaOrigin) * AlphaScale;
+        TValue Value = FNsTweenInterpolator<TValue>::Evaluate(Endpoints, StartValue, EndValue, Alpha);
+        if constexpr (bAdditive)
+        {
+            Value += VelocityOffset * (Alpha * FMath::Square(1.f - Alpha));
+        }
+        return Value;
+    }
+
+private:
+    /** Returns false only for empty nullable callables such as an unset TFunction. */
+    bool IsBound() const
+    {
+        if constexpr (std::is_constructible_v<bool, const TCallable&>)
+        {
+            return static_cast<bool>(UpdateFunction);
+        }
+        else
+        {
+            return true;
+        }
+    }
+
     /** Starting value sampled at the beginning of the tween. */
     TValue StartValue;
 
     /** Target value sampled at the end of the tween. */
     TValue EndValue;
 
+    /** Endpoint data cached for the selected interpolation modes. */
+    typename FNsTweenInterpolator<TValue>::FEndpoints Endpoints;
+
+    /** Offset blended out over the rest of the curve to keep the velocity of a retarget continuous. */
+    FOffset VelocityOffset;
+
+    /** Eased alpha the curve was last retargeted at. */
+    float AlphaOrigin = 0.f;
+
+    /** Maps the eased progress left after AlphaOrigin onto the whole curve. */
+    float AlphaScale = 1.f;
+
+    /** Set once the end value was moved while running. */
+    bool bRetargeted = false;
+
     /** Callback executed whenever the tween produces a new value. */
     FUpdateFunction UpdateFunction;
 };
 
+/** Type-erased callback strategy used by the factory-based spawn path. */
+template <typename TValue>
+using FNsTweenCallbackValue = TNsTweenCallbackValue<TValue, TFunction<void(const TValue&)>>;
+
 /** Creates a callback strategy instance for the provided tween value type. */
 template <typename TValue>
 TSharedPtr<ITweenValue> MakeNsTweenCallbackStrategy(const TValue& StartValue, const TValue& EndValue, TFunction<void(const TValue&)> Update)
 {
     return MakeShared<FNsTweenCallbackValue<TValue>>(StartValue, EndValue, MoveTemp(Update));
 }
-
@@ -0,0 +1,103 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Templates/NsTweenInterpolator.h"
+
+/**
+ * Tween value strategy that drives many targets from one tween: timing and easing run once per frame and only the
+ * blend and the write are paid per target. The callable is invoked as Update(TargetIndex, Value).
+ * Endpoints are either shared by every target (one start and one end value), in which case the value is blended once
+ * and broadcast, or given per target.
+ */
+template <typename TValue, typename TCallable = TFunction<void(int32, const TValue&)>>
+class TNsTweenFanOutValue : public ITweenValue
+{
+public:
+    /** Constructs the strategy; StartValues and EndValues hold either one value or NumTargets values. */
+    template <typename TUpdate>
+    TNsTweenFanOutValue(TArray<TValue> InStartValues, TArray<TValue> InEndValues, int32 InNumTargets, TUpdate&& InUpdate)
+        : StartValues(MoveTemp(InStartValues))
+        , EndValues(MoveTemp(InEndValues))
+        , NumTargets(InNumTargets)
+        , UpdateFunction(Forward<TUpdate>(InUpdate))
+    {
+        check(StartValues.Num() == EndValues.Num() && (StartValues.Num() == 1 || StartValues.Num() == NumTargets));
+    }
+
+    /** Caches endpoint conversions for the spec's interpolation modes, once per distinct pair of endpoints. */
+    virtual void Prepare(const FNsTweenSpec& Spec) override
+    {
+        Endpoints.SetNum(StartValues.Num());
+        for (int32 Index = 0; Index < StartValues.Num(); ++Index)
+        {
+            FNsTweenInterpolator<TValue>::Prepare(Endpoints[Index], StartValues[Index], EndValues[Index], Spec);
+        }
+    }
+
+    /** Applies every target's start value. */
+    virtual void Initialize() override
+    {
+        Write(StartValues);
+    }
+
+    /** Blends every target for the supplied eased alpha. */
+    virtual void Apply(float EasedAlpha) override
+    {
+        if (Endpoints.Num() == 0)
+        {
+            return;
+        }
+
+        if (IsShared())
+        {
+            const TValue Interpolated = FNsTweenInterpolator<TValue>::Evaluate(Endpoints[0], StartValues[0], EndValues[0], EasedAlpha);
+            for (int32 Index = 0; Index < NumTargets; ++Index)
+            {
+                UpdateFunction(Index, Interpolated);
+            }
+            return;
+        }
+
+        for (int32 Index = 0; Index < NumTargets; ++Index)
+        {
+            UpdateFunction(Index, FNsTweenInterpolator<TValue>::Evaluate(Endpoints[Index], StartValues[Index], EndValues[Index], EasedAlpha));
+        }
+    }
+
+    /** Applies every target's end value. */
+    virtual void ApplyFinal() override
+    {
+        Write(EndValues);
+    }
+
+private:
+    /** True when every target shares one pair of endpoints. */
+    bool IsShared() const { return StartValues.Num() == 1; }
+
+    /** Writes exact endpoint values to every target. */
+    void Write(const TArray<TValue>& Values)
+    {
+        for (int32 Index = 0; Index < NumTargets; ++Index)
+        {
+            UpdateFunction(Index, Values[IsShared() ? 0 : Index]);
+        }
+    }
+
+    /** Start values, shared or per target. */
+    TArray<TValue> StartValues;
+
+    /** End values, shared or per target. */
+    TArray<TValue> EndValues;
+
+    /** Endpoint data cached for the selected interpolation modes, one per pair of endpoints. */
+    TArray<typename FNsTweenInterpolator<TValue>::FEndpoints> Endpoints;
+
+    /** Number of targets driven. */
+    int32 NumTargets = 0;
+
+    /** Callback writing one target's value. */
+    TCallable UpdateFunction;
+};
@@ -3,41 +3,152 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Kernels/NsTweenEndpoints.h"
+#include "Kernels/NsTweenKernels.h"
+#include "NsTweenTypeLibrary.h"
 
-/** Provides interpolation helpers for NsTween value types. */
+/**
+ * Provides interpolation helpers for NsTween value types.
+ * Lerp is the stateless blend; Prepare/Evaluate cache endpoint conversions once per tween so per-frame cost is the blend alone.
+ */
 template <typename TValue>
 struct FNsTweenInterpolator
 {
+    /** Plain types blend their raw endpoints and need no cached data. */
+    struct FEndpoints
+    {
+    };
+
+    /** Caches endpoint data for the modes selected on the spec. */
+    static void Prepare(FEndpoints& OutEndpoints, const TValue& A, const TValue& B, const FNsTweenSpec& Spec)
+    {
+    }
+
+    /** Evaluates the blend using cached endpoint data. */
+    static TValue Evaluate(const FEndpoints& Endpoints, const TValue& A, const TValue& B, float Alpha)
+    {
+        return Lerp(A, B, Alpha);
+    }
+
     /** Linearly interpolates between two values of the same type. */
     static TValue Lerp(const TValue& A, const TValue& B, float Alpha)
     {
         return FMath::Lerp(A, B, Alpha);
     }
+
+    /** Blends Count contiguous elements with one shared alpha; floats and doubles run on the SIMD kernels. */
+    static void LerpBuffer(const TValue* A, const TValue* B, float Alpha, TValue* Out, int32 Count)
+    {
+        if constexpr (std::is_same_v<TValue, float>)
+        {
+            FNsTweenKernels::LerpFloatsUniform(A, B, Alpha, Out, Count);
+        }
+        else if constexpr (std::is_same_v<TValue, double>)
+        {
+            FNsTweenKernels::LerpDoublesUniform(A, B, Alpha, Out, Count);
+        }
+        else
+        {
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                Out[Index] = Lerp(A[Index], B[Index], Alpha);
+            }
+        }
+    }
 };
 
 /** Interpolator specialization for FVector2D values. */
 template <>
 struct FNsTweenInterpolator<FVector2D>
 {
+    /** Plain vectors blend their raw endpoints and need no cached data. */
+    struct FEndpoints
+    {
+    };
+
+    /** Nothing to cache for 2D vectors. */
+    static void Prepare(FEndpoints& OutEndpoints, const FVector2D& A, const FVector2D& B, const FNsTweenSpec& Spec)
+    {
+    }
+
+    /** Evaluates the blend using cached endpoint data. */
+    static FVector2D Evaluate(const FEndpoints& Endpoints, const FVector2D& A, const FVector2D& B, float Alpha)
+    {
+        return Lerp(A, B, Alpha);
+    }
+
     /** Interpolates between two 2D vectors using component-wise lerp. */
     static FVector2D Lerp(const FVector2D& A, const FVector2D& B, float Alpha)
     {
         return A + (B - A) * Alpha;
     }
+
+    /** Blends Count contiguous vectors with one shared alpha, as a flat run of doubles. */
+    static void LerpBuffer(const FVector2D* A, const FVector2D* B, float Alpha, FVector2D* Out, int32 Count)
+    {
+        static_assert(sizeof(FVector2D) == 2 * sizeof(double), "FVector2D must be two packed doubles.");
+        FNsTweenKernels::LerpDoublesUniform(&A->X, &B->X, Alpha, &Out->X, 2 * Count);
+    }
+};
+
+/** Interpolator specialization for FVector values. */
+template <>
+struct FNsTweenInterpolator<FVector>
+{
+    /** Plain vectors blend their raw endpoints and need no cached data. */
+    struct FEndpoints
+    {
+    };
+
+    /** Nothing to cache for vectors. */
+    static void Prepare(FEndpoints& OutEndpoints, const FVector& A, const FVector& B, const FNsTweenSpec& Spec)
+    {
+    }
+
+    /** Evaluates the blend using cached endpoint data. */
+    static FVector Evaluate(const FEndpoints& Endpoints, const FVector& A, const FVector& B, float Alpha)
+    {
+        return Lerp(A, B, Alpha);
+    }
+
+    /** Interpolates between two vectors in a single double-precision register. */
+    static FVector Lerp(const FVector& A, const FVector& B, float Alpha)
+    {
+        return FNsTweenKernels::LerpVector(A, B, Alpha);
+    }
+
+    /** Blends Count contiguous vectors with one shared alpha, as a flat run of doubles. */
+    static void LerpBuffer(const FVector* A, const FVector* B, float Alpha, FVector* Out, int32 Count)
+    {
+        static_assert(sizeof(FVector) == 3 * sizeof(double), "FVector must be three packed doubles.");
+        FNsTweenKernels::LerpDoublesUniform(&A->X, &B->X, Alpha, &Out->X, 3 * Count);
+    }
 };
 
 /** Interpolator specialization for FRotator values. */
 template <>
 struct FNsTweenInterpolator<FRotator>
 {
+    /** Rotators cache the representation required by the rotation mode. */
+    using FEndpoints = FNsTweenRotationEndpoints;
+
+    /** Converts the endpoints once for the spec's rotation mode. */
+    static void Prepare(FEndpoints& OutEndpoints, const FRotator& A, const FRotator& B, const FNsTweenSpec& Spec)
+    {
+        OutEndpoints.Prepare(A, B, Spec.RotationMode);
+    }
+
+    /** Evaluates the cached rotation. */
+    static FRotator Evaluate(const FEndpoints& Endpoints, const FRotator& A, const FRotator& B, float Alpha)
+    {
+        return Endpoints.EvaluateRotator(FMath::Clamp(Alpha, 0.f, 1.f));
+    }
+
     /** Interpolates between two rotations via spherical linear interpolation. */
     static FRotator Lerp(const FRotator& A, const FRotator& B, float Alpha)
     {
         const float T = FMath::Clamp(Alpha, 0.f, 1.f);
-        const FQuat QA = A.Quaternion();
-        const FQuat QB = B.Quaternion();
-        const FQuat Q = FQuat::Slerp(QA, QB, T).GetNormalized();
-        return Q.Rotator();
+        return FNsTweenKernels::SlerpQuat(A.Quaternion(), B.Quaternion(), T).Rotator();
     }
 };
 
@@ -45,12 +156,28 @@ struct FNsTweenInterpolator<FRotator>
 template <>
 struct FNsTweenInterpolator<FTransform>
 {
-    /** Interpolates between two transforms with blend semantics. */
+    /** Transforms cache their rotation endpoints; translation and scale blend directly. */
+    using FEndpoints = FNsTweenRotationEndpoints;
+
+    /** Converts the rotation endpoints once for the spec's rotation mode. */
+    static void Prepare(FEndpoints& OutEndpoints, const FTransform& A, const FTransform& B, const FNsTweenSpec& Spec)
+    {
+        OutEndpoints.Prepare(A.GetRotation(), B.GetRotation(), Spec.RotationMode);
+    }
+
+    /** Evaluates translation and scale from the raw endpoints and rotation from the cache. */
+    static FTransform Evaluate(const FEndpoints& Endpoints, const FTransform& A, const FTransform& B, float Alpha)
+    {
+        return FTransform(
+            Endpoints.EvaluateQuat(Alpha),
+            FNsTweenKernels::LerpVector(A.GetTranslation(), B.GetTranslation(), Alpha),
+            FNsTweenKernels::LerpVector(A.GetScale3D(), B.GetScale3D(), Alpha));
+    }
+
+    /** Interpolates between two transforms using the shared transform kernel. */
     static FTransform Lerp(const FTransform& A, const FTransform& B, float Alpha)
     {
-        FTransform Result;
-        Result.Blend(A, B, Alpha);
-        return Result;
+        return FNsTweenKernels::LerpTransform(A, B, Alpha);
     }
 };
 
@@ -58,10 +185,34 @@ struct FNsTweenInterpolator<FTransform>
 template <>
 struct FNsTweenInterpolator<FLinearColor>
 {
-    /** Interpolates between two linear colors using HSV blending. */
+    /** Colors cache their endpoints in the working space of the color mode. */
+    using FEndpoints = FNsTweenColorEndpoints;
+
+    /** Converts the endpoints once for the spec's color mode. */
+    static void Prepare(FEndpoints& OutEndpoints, const FLinearColor& A, const FLinearColor& B, const FNsTweenSpec& Spec)
+    {
+        OutEndpoints.Prepare(A, B, Spec.ColorMode);
+    }
+
+    /** Evaluates the cached color. */
+    static FLinearColor Evaluate(const FEndpoints& Endpoints, const FLinearColor& A, const FLinearColor& B, float Alpha)
+    {
+        return Endpoints.Evaluate(Alpha);
+    }
+
+    /** Interpolates between two linear colors in a single float register. */
     static FLinearColor Lerp(const FLinearColor& A, const FLinearColor& B, float Alpha)
     {
-        return FLinearColor::LerpUsingHSV(A, B, Alpha);
+        FLinearColor Result;
+        LerpBuffer(&A, &B, Alpha, &Result, 1);
+        return Result;
+    }
+
+    /** Blends Count contiguous colors with one shared alpha, as a flat run of floats. */
+    static void LerpBuffer(const FLinearColor* A, const FLinearColor* B, float Alpha, FLinearColor* Out, int32 Count)
+    {
+        static_assert(sizeof(FLinearColor) == 4 * sizeof(float), "FLinearColor must be four packed floats.");
+        FNsTweenKernels::LerpFloatsUniform(&A->R, &B->R, Alpha, &Out->R, 4 * Count);
     }
 };
 
@@ -69,11 +220,25 @@ struct FNsTweenInterpolator<FLinearColor>
 template <>
 struct FNsTweenInterpolator<FQuat>
 {
+    /** Quaternions cache the representation required by the rotation mode. */
+    using FEndpoints = FNsTweenRotationEndpoints;
+
+    /** Converts the endpoints once for the spec's rotation mode. */
+    static void Prepare(FEndpoints& OutEndpoints, const FQuat& A, const FQuat& B, const FNsTweenSpec& Spec)
+    {
+        OutEndpoints.Prepare(A, B, Spec.RotationMode);
+    }
+
+    /** Evaluates the cached rotation. */
+    static FQuat Evaluate(const FEndpoints& Endpoints, const FQuat& A, const FQuat& B, float Alpha)
+    {
+        return Endpoints.EvaluateQuat(FMath::Clamp(Alpha, 0.f, 1.f));
+    }
+
     /** Interpolates between two quaternions via spherical linear interpolation. */
     static FQuat Lerp(const FQuat& A, const FQuat& B, float Alpha)
     {
         const float T = FMath::Clamp(Alpha, 0.f, 1.f);
-        return FQuat::Slerp(A, B, T).GetNormalized();
+        return FNsTweenKernels::SlerpQuat(A, B, T);
     }
 };
-
@@ -0,0 +1,147 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/ITweenValue.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * Owns the value strategy of a tween record.
+ * Strategies that fit are constructed in place inside the record; larger ones fall back to the heap,
+ * and strategies built by callers (the factory path) are adopted as shared pointers.
+ * The heap block outlives its strategy, so a recycled record hosts the next spilled strategy of the same or a smaller
+ * size without allocating.
+ */
+class FNsTweenStrategyStorage
+{
+public:
+    /** Bytes available for in-place strategies; sized so callback strategies for every built-in value type fit. */
+    static constexpr int32 InlineSize = 384;
+
+    /** Alignment guaranteed for in-place strategies. */
+    static constexpr int32 InlineAlignment = 16;
+
+public:
+    FNsTweenStrategyStorage() = default;
+
+    /** Storage is pinned to its record; strategies are never relocated. */
+    FNsTweenStrategyStorage(const FNsTweenStrategyStorage&) = delete;
+
+    /** Storage is pinned to its record; strategies are never relocated. */
+    FNsTweenStrategyStorage& operator=(const FNsTweenStrategyStorage&) = delete;
+
+    /** Destroys the held strategy and frees the heap block. */
+    ~FNsTweenStrategyStorage()
+    {
+        Reset();
+        FreeHeapBlock();
+    }
+
+    /** Constructs a strategy in place, or on the heap when it does not fit the inline buffer. */
+    template <typename TStrategy, typename... TArgs>
+    TStrategy& Emplace(TArgs&&... Args)
+    {
+        static_assert(std::is_base_of_v<ITweenValue, TStrategy>, "Tween strategies must implement ITweenValue.");
+
+        Reset();
+
+        TStrategy* Strategy = nullptr;
+        if constexpr (sizeof(TStrategy) <= InlineSize && alignof(TStrategy) <= InlineAlignment)
+        {
+            Strategy = new (Buffer) TStrategy(Forward<TArgs>(Args)...);
+            bInline = true;
+        }
+        else
+        {
+            if (HeapBlockSize < static_cast<int32>(sizeof(TStrategy)) || HeapBlockAlignment < static_cast<int32>(alignof(TStrategy)))
+            {
+                FreeHeapBlock();
+                HeapBlock = FMemory::Malloc(sizeof(TStrategy), alignof(TStrategy));
+                HeapBlockSize = sizeof(TStrategy);
+                HeapBlockAlignment = alignof(TStrategy);
+                ++HeapAllocations;
+            }
+
+            Strategy = new (HeapBlock) TStrategy(Forward<TArgs>(Args)...);
+            bInline = false;
+        }
+
+        Instance = Strategy;
+        return *Strategy;
+    }
+
+    /** Adopts a strategy created outside the record. */
+    void SetShared(TSharedPtr<ITweenValue> InStrategy)
+    {
+        Reset();
+        Shared = MoveTemp(InStrategy);
+        Instance = Shared.Get();
+    }
+
+    /** Destroys the held strategy and returns the storage to its empty state; the heap block is kept. */
+    void Reset()
+    {
+        if (Instance && !Shared.IsValid())
+        {
+            Instance->~ITweenValue();
+        }
+
+        Shared.Reset();
+        Instance = nullptr;
+        bInline = false;
+    }
+
+    /** Returns the held strategy, or nullptr when empty. */
+    ITweenValue* Get() const { return Instance; }
+
+    /** Returns true when a strategy is held. */
+    bool IsValid() const { return Instance != nullptr; }
+
+    /** Returns true when the strategy lives in the inline buffer. */
+    bool IsInline() const { return bInline; }
+
+    /** Member access to the held strategy. */
+    ITweenValue* operator->() const { return Instance; }
+
+    /** Bytes of the heap block kept for spilled strategies. */
+    int32 GetHeapBlockSize() const { return HeapBlockSize; }
+
+    /** Heap blocks allocated by this storage so far; constant while spilled strategies reuse the block. */
+    int32 GetHeapAllocations() const { return HeapAllocations; }
+
+    /** Frees the heap block; only valid while no spilled strategy lives in it. */
+    void FreeHeapBlock()
+    {
+        check(!Instance || bInline || Shared.IsValid());
+        FMemory::Free(HeapBlock);
+        HeapBlock = nullptr;
+        HeapBlockSize = 0;
+        HeapBlockAlignment = 0;
+    }
+
+private:
+    /** In-place strategy bytes. */
+    alignas(InlineAlignment) uint8 Buffer[InlineSize];
+
+    /** Active strategy, pointing into Buffer, a heap block or Shared. */
+    ITweenValue* Instance = nullptr;
+
+    /** Keeps factory-built strategies alive. */
+    TSharedPtr<ITweenValue> Shared;
+
+    /** Heap block hosting strategies too large for Buffer. */
+    void* HeapBlock = nullptr;
+
+    /** Size of HeapBlock. */
+    int32 HeapBlockSize = 0;
+
+    /** Alignment of HeapBlock. */
+    int32 HeapBlockAlignment = 0;
+
+    /** Heap blocks allocated so far. */
+    int32 HeapAllocations = 0;
+
+    /** True when Instance lives in Buffer. */
+    bool bInline = false;
+};
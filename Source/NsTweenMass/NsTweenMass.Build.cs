@@ -0,0 +1,22 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+using UnrealBuildTool;
+
+public class NsTweenMass : ModuleRules
+{
+    public NsTweenMass(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "CoreUObject",
+                "Engine",
+                "MassEntity",
+                "NsTween",
+            }
+        );
+    }
+}
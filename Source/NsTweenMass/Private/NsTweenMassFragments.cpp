@@ -0,0 +1,88 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "NsTweenMassFragments.h"
+
+void FNsTweenMassTimingFragment::Initialize(const FNsTweenSpec& Spec)
+{
+    DurationSeconds = FMath::Max(Spec.DurationSeconds, SMALL_NUMBER);
+    DelaySeconds = FMath::Max(0.f, Spec.DelaySeconds);
+    TimeScale = FMath::Max(Spec.TimeScale, 0.f);
+    LoopCount = FMath::Max(Spec.LoopCount, 0);
+    WrapMode = Spec.WrapMode;
+    Direction = Spec.Direction;
+    Restart();
+}
+
+void FNsTweenMassTimingFragment::Restart()
+{
+    DelayRemaining = DelaySeconds;
+    CompletedCycles = 0;
+    bPlayingForward = Direction == ENsTweenDirection::Forward;
+    CycleTime = bPlayingForward ? 0.f : DurationSeconds;
+}
+
+bool FNsTweenMassTimingFragment::Advance(float DeltaSeconds)
+{
+    float RemainingTime = DeltaSeconds * TimeScale;
+    if (RemainingTime <= SMALL_NUMBER)
+    {
+        return true;
+    }
+
+    if (DelayRemaining > SMALL_NUMBER)
+    {
+        if (RemainingTime < DelayRemaining)
+        {
+            DelayRemaining -= RemainingTime;
+            return true;
+        }
+
+        RemainingTime -= DelayRemaining;
+        DelayRemaining = 0.f;
+    }
+
+    // Same boundary walk as FNsTween::Tick, so large steps cross several loops exactly.
+    while (RemainingTime > SMALL_NUMBER)
+    {
+        const float TimeToBoundary = FMath::Max(bPlayingForward ? DurationSeconds - CycleTime : CycleTime, 0.f);
+        if (RemainingTime <= TimeToBoundary + KINDA_SMALL_NUMBER)
+        {
+            CycleTime = FMath::Clamp(CycleTime + (bPlayingForward ? RemainingTime : -RemainingTime), 0.f, DurationSeconds);
+            return true;
+        }
+
+        RemainingTime -= TimeToBoundary;
+        CycleTime = bPlayingForward ? DurationSeconds : 0.f;
+
+        if (WrapMode == ENsTweenWrapMode::Once)
+        {
+            return false;
+        }
+
+        if (WrapMode == ENsTweenWrapMode::Loop)
+        {
+            ++CompletedCycles;
+            if (LoopCount > 0 && CompletedCycles >= LoopCount)
+            {
+                return false;
+            }
+
+            bPlayingForward = Direction != ENsTweenDirection::Backward;
+            CycleTime = bPlayingForward ? 0.f : DurationSeconds;
+        }
+        else
+        {
+            bPlayingForward = !bPlayingForward;
+            if (!bPlayingForward)
+            {
+                ++CompletedCycles;
+            }
+            else if (LoopCount > 0 && CompletedCycles >= LoopCount)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
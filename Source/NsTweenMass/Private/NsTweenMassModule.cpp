@@ -0,0 +1,5 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, NsTweenMass)
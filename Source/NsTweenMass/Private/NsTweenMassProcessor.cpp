@@ -0,0 +1,98 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "NsTweenMassProcessor.h"
+#include "Easing/NsTweenPolynomialEasing.h"
+#include "MassCommandBuffer.h"
+#include "MassExecutionContext.h"
+#include "NsTweenMassFragments.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Templates/NsTweenInterpolator.h"
+
+namespace NsTweenMass
+{
+    /** Adds the requirements shared by every typed pass: the eased alpha, and only running tweens. */
+    void AddValueRequirements(FMassEntityQuery& Query)
+    {
+        Query.AddRequirement<FNsTweenMassEasingFragment>(EMassFragmentAccess::ReadOnly);
+        Query.AddTagRequirement<FNsTweenMassFinishedTag>(EMassFragmentPresence::None);
+    }
+
+    /** Blends the endpoints of one value fragment type for every entity of the query, in chunk order. */
+    template <typename TFragment, typename TValue>
+    void ApplyValues(FMassEntityQuery& Query, FMassExecutionContext& Context)
+    {
+        Query.ParallelForEachEntityChunk(Context, [](FMassExecutionContext& ChunkContext)
+        {
+            const TConstArrayView<FNsTweenMassEasingFragment> Easings = ChunkContext.GetFragmentView<FNsTweenMassEasingFragment>();
+            const TArrayView<TFragment> Values = ChunkContext.GetMutableFragmentView<TFragment>();
+            const int32 NumEntities = ChunkContext.GetNumEntities();
+            for (int32 Index = 0; Index < NumEntities; ++Index)
+            {
+                TFragment& Value = Values[Index];
+                Value.Value = FNsTweenInterpolator<TValue>::Lerp(Value.Start, Value.End, Easings[Index].EasedAlpha);
+            }
+        });
+    }
+}
+
+UNsTweenMassProcessor::UNsTweenMassProcessor()
+    : TimingQuery(*this)
+    , FloatQuery(*this)
+    , VectorQuery(*this)
+    , QuatQuery(*this)
+    , ColorQuery(*this)
+{
+    ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+    ProcessingPhase = EMassProcessingPhase::PrePhysics;
+    bAutoRegisterWithProcessingPhases = true;
+    bRequiresGameThreadExecution = false;
+}
+
+void UNsTweenMassProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+    TimingQuery.AddRequirement<FNsTweenMassTimingFragment>(EMassFragmentAccess::ReadWrite);
+    TimingQuery.AddRequirement<FNsTweenMassEasingFragment>(EMassFragmentAccess::ReadWrite);
+    TimingQuery.AddTagRequirement<FNsTweenMassFinishedTag>(EMassFragmentPresence::None);
+
+    FloatQuery.AddRequirement<FNsTweenMassFloatFragment>(EMassFragmentAccess::ReadWrite);
+    NsTweenMass::AddValueRequirements(FloatQuery);
+
+    VectorQuery.AddRequirement<FNsTweenMassVectorFragment>(EMassFragmentAccess::ReadWrite);
+    NsTweenMass::AddValueRequirements(VectorQuery);
+
+    QuatQuery.AddRequirement<FNsTweenMassQuatFragment>(EMassFragmentAccess::ReadWrite);
+    NsTweenMass::AddValueRequirements(QuatQuery);
+
+    ColorQuery.AddRequirement<FNsTweenMassColorFragment>(EMassFragmentAccess::ReadWrite);
+    NsTweenMass::AddValueRequirements(ColorQuery);
+}
+
+void UNsTweenMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT("NsTweenMassProcessor::Execute");
+
+    TimingQuery.ParallelForEachEntityChunk(Context, [](FMassExecutionContext& ChunkContext)
+    {
+        const TArrayView<FNsTweenMassTimingFragment> Timings = ChunkContext.GetMutableFragmentView<FNsTweenMassTimingFragment>();
+        const TArrayView<FNsTweenMassEasingFragment> Easings = ChunkContext.GetMutableFragmentView<FNsTweenMassEasingFragment>();
+        const float DeltaSeconds = ChunkContext.GetDeltaTimeSeconds();
+        const int32 NumEntities = ChunkContext.GetNumEntities();
+        for (int32 Index = 0; Index < NumEntities; ++Index)
+        {
+            FNsTweenMassTimingFragment& Timing = Timings[Index];
+            const bool bRunning = Timing.Advance(DeltaSeconds);
+            Easings[Index].EasedAlpha = FNsTweenPolynomialEasing::EvaluatePreset(Easings[Index].Ease, Timing.GetLinearAlpha());
+
+            // The tag lands when the command buffer is flushed, so the typed passes below still write the final value.
+            if (!bRunning)
+            {
+                ChunkContext.Defer().AddTag<FNsTweenMassFinishedTag>(ChunkContext.GetEntity(Index));
+            }
+        }
+    });
+
+    NsTweenMass::ApplyValues<FNsTweenMassFloatFragment, float>(FloatQuery, Context);
+    NsTweenMass::ApplyValues<FNsTweenMassVectorFragment, FVector>(VectorQuery, Context);
+    NsTweenMass::ApplyValues<FNsTweenMassQuatFragment, FQuat>(QuatQuery, Context);
+    NsTweenMass::ApplyValues<FNsTweenMassColorFragment, FLinearColor>(ColorQuery, Context);
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "NsTweenMassFragments.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsTweenMassTimingTest, "NsTween.Mass.Timing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+
+bool FNsTweenMassTimingTest::RunTest(const FString& Parameters)
+{
+    FNsTweenSpec Spec;
+    Spec.DurationSeconds = 1.f;
+    Spec.DelaySeconds = 0.5f;
+    Spec.WrapMode = ENsTweenWrapMode::PingPong;
+    Spec.LoopCount = 1;
+
+    FNsTweenMassTimingFragment Timing;
+    Timing.Initialize(Spec);
+
+    TestTrue(TEXT("Delay is consumed first"), Timing.Advance(0.5f));
+    TestEqual(TEXT("Nothing moves during the delay"), Timing.GetLinearAlpha(), 0.f);
+
+    TestTrue(TEXT("Forward leg runs"), Timing.Advance(0.75f));
+    TestEqual(TEXT("Forward leg advances"), Timing.GetLinearAlpha(), 0.75f, 1.e-4f);
+
+    // One step crosses the turn-around and lands on the way back.
+    TestTrue(TEXT("Backward leg runs"), Timing.Advance(0.5f));
+    TestEqual(TEXT("Ping-pong turns around"), Timing.GetLinearAlpha(), 0.75f, 1.e-4f);
+
+    TestFalse(TEXT("One ping-pong pair completes"), Timing.Advance(1.f));
+    TestEqual(TEXT("Completed at the start"), Timing.GetLinearAlpha(), 0.f);
+
+    // Replaying a finished fragment starts over, delay included.
+    Timing.Restart();
+    TestTrue(TEXT("Restart replays the delay"), Timing.Advance(0.5f));
+    TestTrue(TEXT("Restarted playback runs again"), Timing.Advance(0.25f));
+    TestEqual(TEXT("Restarted playback moves from the start"), Timing.GetLinearAlpha(), 0.25f, 1.e-4f);
+
+    return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
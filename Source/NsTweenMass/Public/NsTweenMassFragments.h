@@ -0,0 +1,177 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "NsTweenTypeLibrary.h"
+#include "NsTweenMassFragments.generated.h"
+
+/**
+ * Playback state of a Mass tween: the same timing rules as FNsTween (delay, time scale, loop and ping-pong wrap
+ * modes, direction) without callbacks, so it can be advanced chunk by chunk on any worker.
+ */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassTimingFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+    /** Resets the playback state from a tween spec; callbacks, owner and easing on the spec are ignored. */
+    void Initialize(const FNsTweenSpec& Spec);
+
+    /** Rewinds the playback to its start, delay included, keeping the timing settings; used to replay a finished tween. */
+    void Restart();
+
+    /** Advances the playback by DeltaSeconds; returns false once the tween has completed. */
+    bool Advance(float DeltaSeconds);
+
+    /** Returns the normalized time of the current cycle. */
+    float GetLinearAlpha() const { return FMath::Clamp(CycleTime / DurationSeconds, 0.f, 1.f); }
+
+    /** Time within the current cycle. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float CycleTime = 0.f;
+
+    /** Length of one cycle in seconds. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float DurationSeconds = 0.5f;
+
+    /** Delay before the tween starts moving, replayed by Restart. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float DelaySeconds = 0.f;
+
+    /** Delay left before the tween starts moving. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float DelayRemaining = 0.f;
+
+    /** Time scale applied to the delta time. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float TimeScale = 1.f;
+
+    /** Loops or ping-pong pairs to play; 0 repeats forever. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    int32 LoopCount = 0;
+
+    /** Loops or ping-pong pairs completed so far. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    int32 CompletedCycles = 0;
+
+    /** How the tween repeats. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    ENsTweenWrapMode WrapMode = ENsTweenWrapMode::Once;
+
+    /** Direction each loop restarts in. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    ENsTweenDirection Direction = ENsTweenDirection::Forward;
+
+    /** True while the cycle time moves towards the duration. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    bool bPlayingForward = true;
+};
+
+/** Easing of a Mass tween and the eased alpha written by the timing pass for the typed passes to read. */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassEasingFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+    /** Polynomial preset; bezier and curve asset presets evaluate linearly. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    ENsTweenEase Ease = ENsTweenEase::InOutSine;
+
+    /** Eased alpha of the current frame. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float EasedAlpha = 0.f;
+};
+
+/** Float tween endpoints and the interpolated value. */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassFloatFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+    /** Value at alpha 0. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float Start = 0.f;
+
+    /** Value at alpha 1. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float End = 0.f;
+
+    /** Value written by the last processor pass. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    float Value = 0.f;
+};
+
+/** Vector tween endpoints and the interpolated value. */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassVectorFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+    /** Value at alpha 0. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FVector Start = FVector::ZeroVector;
+
+    /** Value at alpha 1. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FVector End = FVector::ZeroVector;
+
+    /** Value written by the last processor pass. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FVector Value = FVector::ZeroVector;
+};
+
+/** Rotation tween endpoints and the interpolated value, blended along the shortest arc. */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassQuatFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+    /** Value at alpha 0. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FQuat Start = FQuat::Identity;
+
+    /** Value at alpha 1. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FQuat End = FQuat::Identity;
+
+    /** Value written by the last processor pass. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FQuat Value = FQuat::Identity;
+};
+
+/** Color tween endpoints and the interpolated value, blended in linear RGB. */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassColorFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+    /** Value at alpha 0. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FLinearColor Start = FLinearColor::White;
+
+    /** Value at alpha 1. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FLinearColor End = FLinearColor::White;
+
+    /** Value written by the last processor pass. */
+    UPROPERTY(EditAnywhere, Category = "Tween")
+    FLinearColor Value = FLinearColor::White;
+};
+
+/**
+ * Added once a tween completes; finished entities are skipped by the tween processor. A finished timing fragment keeps
+ * its end position, so to replay call FNsTweenMassTimingFragment::Restart (or Initialize) before removing the tag.
+ */
+USTRUCT()
+struct NSTWEENMASS_API FNsTweenMassFinishedTag : public FMassTag
+{
+    GENERATED_BODY()
+};
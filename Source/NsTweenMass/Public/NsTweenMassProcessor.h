@@ -0,0 +1,43 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+#include "NsTweenMassProcessor.generated.h"
+
+/**
+ * Advances every Mass tween and writes its typed values, chunk by chunk and in parallel.
+ * A timing pass advances FNsTweenMassTimingFragment and stores the eased alpha in FNsTweenMassEasingFragment; one pass
+ * per value fragment type then blends that type's endpoints with the NsTween interpolators. Completed entities get
+ * FNsTweenMassFinishedTag through the deferred command buffer, after their final value was written this frame.
+ */
+UCLASS()
+class NSTWEENMASS_API UNsTweenMassProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UNsTweenMassProcessor();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+    /** Running tweens: timing and easing. */
+    FMassEntityQuery TimingQuery;
+
+    /** Running float tweens. */
+    FMassEntityQuery FloatQuery;
+
+    /** Running vector tweens. */
+    FMassEntityQuery VectorQuery;
+
+    /** Running rotation tweens. */
+    FMassEntityQuery QuatQuery;
+
+    /** Running color tweens. */
+    FMassEntityQuery ColorQuery;
+};